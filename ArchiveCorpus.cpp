@@ -0,0 +1,641 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for stream operations (saving and loading an archive)
+#include <iostream>
+
+// Necessary for vector operations (renumbering word IDs)
+#include <vector>
+
+// Field and method declarations for the ArchiveCorpus class
+#include "ArchiveCorpus.h"
+
+// Storage for the tokens, vocabulary and document starts
+#include "VectorChunked.h"
+#include "VectorChunked.cpp" // .cpp required here due to generic/template functionality of this class
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------------------X
+// |    #getDocumentEnd(unsigned int)    |
+// X-------------------------------------X
+// Returns one past the last position of the document holding somePosition
+unsigned int ArchiveCorpus::getDocumentEnd(unsigned int somePosition) const {
+   unsigned int documentID = getDocumentOf(somePosition);
+   // The final document runs to the end of the archive
+   if (documentID + 1 >= getDocumentCount()) {
+      return(getTokenCount());
+   }
+   return(getDocumentStart(documentID + 1));
+}
+
+// X---------------------------------------------X
+// |    #appendWordTo(string&, unsigned int)    |
+// X---------------------------------------------X
+// A viewed word is appended straight from the mapping, its length taken from the next word's offset
+void ArchiveCorpus::appendWordTo(string& someString, unsigned int someWordID) const {
+   if (!isViewAttached) {
+      someString += vocabulary[someWordID];
+   }
+   else if (someWordID < viewVocabularyCount) {
+      someString.append(viewBytes + viewOffsets[someWordID], viewOffsets[someWordID + 1] - viewOffsets[someWordID] - 1);
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #beginDocument()    |
+// X------------------------X
+// Marks the start of a new document at the next token position and returns its ID
+unsigned int ArchiveCorpus::beginDocument() {
+   documentStarts.push_back(tokenIDs.size());
+   return(documentStarts.size() - 1);
+}
+
+// X-----------------------X
+// |    #append(string)    |
+// X-----------------------X
+// Interns a word, stores it at the next token position and returns that position
+unsigned int ArchiveCorpus::append(const string& aWord) {
+   tokenIDs.push_back(intern(aWord));
+   return(tokenIDs.size() - 1);
+}
+
+// X-------------------------------X
+// |    #appendID(unsigned int)    |
+// X-------------------------------X
+// Stores a word ID at the next token position and returns that position
+unsigned int ArchiveCorpus::appendID(unsigned int someWordID) {
+   tokenIDs.push_back(someWordID);
+   return(tokenIDs.size() - 1);
+}
+
+// X-----------------------X
+// |    #intern(string)    |
+// X-----------------------X
+// Returns the word ID of aWord, assigning the next free ID if it is unseen
+unsigned int ArchiveCorpus::intern(const string& aWord) {
+   unordered_map<string, unsigned int>::iterator foundIt = vocabularyIndex.find(aWord);
+   if (foundIt != vocabularyIndex.end()) {
+      return(foundIt->second);
+   }
+   unsigned int wordID = vocabulary.size();
+   vocabulary.push_back(aWord);
+   vocabularyIndex[aWord] = wordID;
+   return(wordID);
+}
+
+// X------------------------------------------X
+// |    #findWordID(string, unsigned int&)    |
+// X------------------------------------------X
+// Finds the word ID of aWord, leaving the vocabulary unchanged. A view is searched by binary search on viewOrder.
+bool ArchiveCorpus::findWordID(const string& aWord, unsigned int& someWordID) const {
+   if (isViewAttached) {
+      // Invariant: every word ordered before lowIndex sorts before aWord, and none from highIndex on does
+      unsigned int lowIndex = 0;
+      unsigned int highIndex = viewVocabularyCount;
+      while (lowIndex < highIndex) {
+         unsigned int midIndex = lowIndex + (highIndex - lowIndex) / 2;
+         unsigned int midID = viewOrder[midIndex];
+         int wordOrder = aWord.compare(0, string::npos, viewBytes + viewOffsets[midID], viewOffsets[midID + 1] - viewOffsets[midID] - 1);
+         if (wordOrder == 0) {
+            someWordID = midID;
+            return(true);
+         }
+         if (wordOrder > 0) {
+            lowIndex = midIndex + 1;
+         }
+         else {
+            highIndex = midIndex;
+         }
+      }
+      return(false);
+   }
+   unordered_map<string, unsigned int>::const_iterator foundIt = vocabularyIndex.find(aWord);
+   if (foundIt == vocabularyIndex.end()) {
+      return(false);
+   }
+   someWordID = foundIt->second;
+   return(true);
+}
+
+// X------------------------------X
+// |    #getWord(unsigned int)    |
+// X------------------------------X
+// Returns the word stored at a token position
+string ArchiveCorpus::getWord(unsigned int somePosition) const {
+   return(getVocabularyWord(getWordID(somePosition)));
+}
+
+// X--------------------------------X
+// |    #getWordID(unsigned int)    |
+// X--------------------------------X
+// Returns the interned ID of the word stored at a token position
+unsigned int ArchiveCorpus::getWordID(unsigned int somePosition) const {
+   if (isViewAttached) {
+      return(viewTokens[somePosition]);
+   }
+   return(tokenIDs[somePosition]);
+}
+
+// X----------------------------------------X
+// |    #getVocabularyWord(unsigned int)    |
+// X----------------------------------------X
+// Returns the word stored under an interned ID
+string ArchiveCorpus::getVocabularyWord(unsigned int someWordID) const {
+   if (isViewAttached) {
+      string retWord;
+      appendWordTo(retWord, someWordID);
+      return(retWord);
+   }
+   return(vocabulary[someWordID]);
+}
+
+// X-----------------------------------------X
+// |    #getVocabularyEntry(unsigned int)    |
+// X-----------------------------------------X
+// Returns a reference into the vocabulary, whose chunks never move
+const string& ArchiveCorpus::getVocabularyEntry(unsigned int someWordID) const {
+   return(vocabulary[someWordID]);
+}
+
+// X------------------------------------X
+// |    #getDocumentOf(unsigned int)    |
+// X------------------------------------X
+// Returns the document holding a token position: the last document starting at or before it
+unsigned int ArchiveCorpus::getDocumentOf(unsigned int somePosition) const {
+   // Invariant: the answer lies in [lowIndex, highIndex); documentStarts[0] is always at or before somePosition
+   size_t lowIndex = 0;
+   size_t highIndex = getDocumentCount();
+   while (highIndex - lowIndex > 1) {
+      size_t midIndex = lowIndex + (highIndex - lowIndex) / 2;
+      if (getDocumentStart(midIndex) <= somePosition) {
+         lowIndex = midIndex;
+      }
+      else {
+         highIndex = midIndex;
+      }
+   }
+   return(lowIndex);
+}
+
+// X---------------------------------------X
+// |    #getDocumentStart(unsigned int)    |
+// X---------------------------------------X
+// Returns the first token position of a document
+unsigned int ArchiveCorpus::getDocumentStart(unsigned int someDocumentID) const {
+   if (isViewAttached) {
+      return(viewStarts[someDocumentID]);
+   }
+   return(documentStarts[someDocumentID]);
+}
+
+// X--------------------------------------------------X
+// |    #getWindowHash(unsigned int, unsigned int)    |
+// X--------------------------------------------------X
+// FNV-1a over the document ID and the window's word IDs, each shifted up by one so that 0 marks a slot
+// outside the document, as the context strings leave those slots blank
+unsigned long long ArchiveCorpus::getWindowHash(unsigned int somePosition, unsigned int someSpan) const {
+   unsigned int documentID = getDocumentOf(somePosition);
+   unsigned int documentStart = getDocumentStart(documentID);
+   unsigned int documentEnd = getDocumentEnd(somePosition);
+   unsigned long long retHash = 14695981039346656037ULL ^ documentID;
+   for (unsigned int i = 0 ; i < someSpan + 10 ; i++) {
+      unsigned long long slotID = 0;
+      if (somePosition + i >= documentStart + 5 && somePosition + i < documentEnd + 5) {
+         slotID = (unsigned long long)getWordID(somePosition + i - 5) + 1;
+      }
+      retHash = (retHash ^ slotID) * 1099511628211ULL;
+   }
+   return(retHash);
+}
+
+// X---------------------------------------------------------------X
+// |    #isSameWindow(unsigned int, unsigned int, unsigned int)    |
+// X---------------------------------------------------------------X
+// Two windows match when they share a document and every slot holds the same word or is outside it in both
+bool ArchiveCorpus::isSameWindow(unsigned int somePosition, unsigned int otherPosition, unsigned int someSpan) const {
+   unsigned int documentID = getDocumentOf(somePosition);
+   if (getDocumentOf(otherPosition) != documentID) {
+      return(false);
+   }
+   unsigned int documentStart = getDocumentStart(documentID);
+   unsigned int documentEnd = getDocumentEnd(somePosition);
+   for (unsigned int i = 0 ; i < someSpan + 10 ; i++) {
+      bool someInside = (somePosition + i >= documentStart + 5 && somePosition + i < documentEnd + 5);
+      bool otherInside = (otherPosition + i >= documentStart + 5 && otherPosition + i < documentEnd + 5);
+      if (someInside != otherInside) {
+         return(false);
+      }
+      if (someInside && getWordID(somePosition + i - 5) != getWordID(otherPosition + i - 5)) {
+         return(false);
+      }
+   }
+   return(true);
+}
+
+// X-------------------------------------X
+// |    #getPrevContext(unsigned int)    |
+// X-------------------------------------X
+// Rebuilds the five words before a position in ReaderCorpus format ("w1 w2 w3 w4 w5 ")
+string ArchiveCorpus::getPrevContext(unsigned int somePosition) const {
+   unsigned int documentStart = getDocumentStart(getDocumentOf(somePosition));
+   string retString = "";
+   // Invariant: i counts down the distance from the keyword. Slots before the document start stay empty.
+   for (unsigned int i = 5 ; i > 0 ; i--) {
+      if (somePosition >= documentStart + i) {
+         appendWordTo(retString, getWordID(somePosition - i));
+      }
+      retString = retString + " ";
+   }
+   return(retString);
+}
+
+// X-------------------------------------X
+// |    #getPostContext(unsigned int)    |
+// X-------------------------------------X
+// Rebuilds the five words after a position in ReaderCorpus format (" w1 w2 w3 w4 w5")
+string ArchiveCorpus::getPostContext(unsigned int somePosition) const {
+   unsigned int documentEnd = getDocumentEnd(somePosition);
+   string retString = "";
+   // Invariant: i counts up the distance from the keyword. Slots past the document end hold the " " filler.
+   for (unsigned int i = 1 ; i <= 5 ; i++) {
+      if (somePosition + i < documentEnd) {
+         retString = retString + " ";
+         appendWordTo(retString, getWordID(somePosition + i));
+      }
+      else {
+         retString = retString + "  ";
+      }
+   }
+   return(retString);
+}
+
+// X-----------------------X
+// |    #save(ostream&)    |
+// X-----------------------X
+// Writes a header line of counts, then one word per line in ID order, then the token IDs and the
+// document starts sixteen to a line. Cleaned words hold no whitespace, so no quoting is needed.
+bool ArchiveCorpus::save(ostream& someStream) const {
+   someStream << "archive " << vocabulary.size() << " " << tokenIDs.size() << " " << documentStarts.size() << "\n";
+   for (size_t i = 0 ; i < vocabulary.size() ; i++) {
+      someStream << vocabulary[i] << "\n";
+   }
+   for (size_t i = 0 ; i < tokenIDs.size() ; i++) {
+      someStream << tokenIDs[i] << (((i % 16) == 15) ? "\n" : " ");
+   }
+   someStream << "\n";
+   for (size_t i = 0 ; i < documentStarts.size() ; i++) {
+      someStream << documentStarts[i] << (((i % 16) == 15) ? "\n" : " ");
+   }
+   someStream << "\n";
+   return(!someStream.fail());
+}
+
+// X-----------------------X
+// |    #load(istream&)    |
+// X-----------------------X
+// Reads an archive written by save(). Words are re-interned in ID order, so each receives its saved ID.
+bool ArchiveCorpus::load(istream& someStream) {
+   string headerTag;
+   size_t wordCount = 0;
+   size_t tokenCount = 0;
+   size_t documentCount = 0;
+   someStream >> headerTag >> wordCount >> tokenCount >> documentCount;
+   if (someStream.fail() || headerTag != "archive" || tokenIDs.size() != 0 || vocabulary.size() != 0) {
+      return(false);
+   }
+   for (size_t i = 0 ; i < wordCount ; i++) {
+      string aWord;
+      someStream >> aWord;
+      // A repeated word would be given an earlier ID than the one the tokens refer to
+      if (someStream.fail() || intern(aWord) != i) {
+         return(false);
+      }
+   }
+   for (size_t i = 0 ; i < tokenCount ; i++) {
+      unsigned int wordID = 0;
+      someStream >> wordID;
+      if (someStream.fail() || wordID >= wordCount) {
+         return(false);
+      }
+      tokenIDs.push_back(wordID);
+   }
+   unsigned int previousStart = 0;
+   for (size_t i = 0 ; i < documentCount ; i++) {
+      unsigned int documentStart = 0;
+      someStream >> documentStart;
+      if (someStream.fail() || documentStart < previousStart || documentStart > tokenCount) {
+         return(false);
+      }
+      documentStarts.push_back(documentStart);
+      previousStart = documentStart;
+   }
+   return(true);
+}
+
+// X-----------------------------------------------------X
+// |    #attachView(unsigned int*, unsigned int, ...)    |
+// X-----------------------------------------------------X
+// Only the pointers are kept; nothing is read until a position is rendered or a word looked up
+bool ArchiveCorpus::attachView(const unsigned int* someTokens, unsigned int someTokenCount, const unsigned int* someStarts, unsigned int someDocumentCount,
+                               const unsigned int* someOffsets, const char* someBytes, const unsigned int* someOrder, unsigned int someVocabularyCount) {
+   if (isViewAttached || tokenIDs.size() != 0 || vocabulary.size() != 0 || documentStarts.size() != 0) {
+      return(false);
+   }
+   viewTokens = someTokens;
+   viewTokenCount = someTokenCount;
+   viewStarts = someStarts;
+   viewDocumentCount = someDocumentCount;
+   viewOffsets = someOffsets;
+   viewBytes = someBytes;
+   viewOrder = someOrder;
+   viewVocabularyCount = someVocabularyCount;
+   isViewAttached = true;
+   return(true);
+}
+
+// X------------------------------------X
+// |    #discardBefore(unsigned int)    |
+// X------------------------------------X
+// Copies the kept tokens into fresh storage, interning their words anew in order of first use, then swaps
+// the copies in. O(tokens kept + documents).
+void ArchiveCorpus::discardBefore(unsigned int someShift) {
+   VectorChunked<string> keptVocabulary;
+   unordered_map<string, unsigned int> keptIndex;
+   VectorChunked<unsigned int> keptTokens;
+   VectorChunked<unsigned int> keptStarts;
+   // #newIDs - Renumbered ID of each old word ID, or the vocabulary size while it is unused
+   vector<unsigned int> newIDs(vocabulary.size(), vocabulary.size());
+   for (size_t i = someShift ; i < tokenIDs.size() ; i++) {
+      unsigned int wordID = tokenIDs[i];
+      if (newIDs[wordID] == vocabulary.size()) {
+         newIDs[wordID] = keptVocabulary.size();
+         keptVocabulary.push_back(vocabulary[wordID]);
+         keptIndex[vocabulary[wordID]] = newIDs[wordID];
+      }
+      keptTokens.push_back(newIDs[wordID]);
+   }
+   for (size_t i = 0 ; i < documentStarts.size() ; i++) {
+      keptStarts.push_back((documentStarts[i] > someShift) ? documentStarts[i] - someShift : 0);
+   }
+   vocabulary.swap(keptVocabulary);
+   vocabularyIndex.swap(keptIndex);
+   tokenIDs.swap(keptTokens);
+   documentStarts.swap(keptStarts);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #ArchiveCorpus()    |
+// X------------------------X
+// Default constructor. Makes an empty archive with no documents.
+ArchiveCorpus::ArchiveCorpus() {
+   viewTokens = nullptr;
+   viewStarts = nullptr;
+   viewOffsets = nullptr;
+   viewOrder = nullptr;
+   viewBytes = nullptr;
+   viewTokenCount = 0;
+   viewDocumentCount = 0;
+   viewVocabularyCount = 0;
+   isViewAttached = false;
+}
+
+// X-------------------------X
+// |    #~ArchiveCorpus()    |
+// X-------------------------X
+// Destructor. Defined here, where VectorChunked's definitions are visible.
+ArchiveCorpus::~ArchiveCorpus() {
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #getTokenCount()    |
+// X------------------------X
+// Returns the number of token positions stored
+unsigned int ArchiveCorpus::getTokenCount() const {
+   if (isViewAttached) {
+      return(viewTokenCount);
+   }
+   return(tokenIDs.size());
+}
+
+// X---------------------------X
+// |    #getDocumentCount()    |
+// X---------------------------X
+// Returns the number of documents begun
+unsigned int ArchiveCorpus::getDocumentCount() const {
+   if (isViewAttached) {
+      return(viewDocumentCount);
+   }
+   return(documentStarts.size());
+}
+
+// X----------------------------X
+// |    #getVocabularySize()    |
+// X----------------------------X
+// Returns the number of distinct words stored
+unsigned int ArchiveCorpus::getVocabularySize() const {
+   if (isViewAttached) {
+      return(viewVocabularyCount);
+   }
+   return(vocabulary.size());
+}
+
+// X-----------------X
+// |    #isView()    |
+// X-----------------X
+// Returns whether attachView() was called
+bool ArchiveCorpus::isView() const {
+   return(isViewAttached);
+}
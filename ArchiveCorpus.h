@@ -0,0 +1,547 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for stream operations (saving and loading an archive)
+#include <iostream>
+
+// Append-only storage whose elements never move (token and vocabulary storage)
+#include "VectorChunked.h"
+
+// Necessary for hash table operations (word interning)
+#include <unordered_map>
+
+using namespace std;
+
+// X----------------------X
+// |    #ArchiveCorpus    |
+// X----------------------X
+// Description: Stores the cleaned corpus as an array of interned word IDs, one per token position,
+//              along with the position at which each document starts. Occurrences elsewhere are kept
+//              as positions into this array and their context strings are rebuilt from it on demand.
+//              Storage is append-only and never relocated, so while one thread appends, others may read
+//              every position below the getTokenCount() they observe (ie. to render a published snapshot).
+//              The interning index is the writer's alone. An archive may instead be a read-only view of a
+//              mapped suffix index (attachView()), reading the mapped arrays where they lie.
+class ArchiveCorpus {
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------X
+// |    #vocabulary    |
+// X-------------------X
+// Description: Each distinct word, indexed by its word ID
+// Invariants:  No word appears twice
+VectorChunked<string> vocabulary;
+
+// X------------------------X
+// |    #vocabularyIndex    |
+// X------------------------X
+// Description: Reverse lookup from a word to its word ID
+// Invariants:  vocabulary[vocabularyIndex[w]] == w for every stored w
+unordered_map<string, unsigned int> vocabularyIndex;
+
+// X-----------------X
+// |    #tokenIDs    |
+// X-----------------X
+// Description: Word ID at each token position, across all documents
+// Invariants:  Every entry is a valid index into vocabulary
+VectorChunked<unsigned int> tokenIDs;
+
+// X-----------------------X
+// |    #documentStarts    |
+// X-----------------------X
+// Description: First token position of each document, indexed by document ID
+// Invariants:  Non-decreasing. A document ends where the next begins, or at the end of tokenIDs.
+VectorChunked<unsigned int> documentStarts;
+
+// X-------------------X
+// |    #viewTokens    |
+// X-------------------X
+// Description: A mapped index's arrays, read in place of the fields above once attachView() is called: the
+//              word ID at each position, the first position of each document, and each word's offset into
+//              viewBytes, where word i runs up to one byte short of offset i + 1. viewOrder lists the word
+//              IDs in the byte order of their words, for findWordID().
+// Invariants:  nullptr and 0 unless isViewAttached. Offsets ascend and the last is within viewBytes.
+const unsigned int* viewTokens;
+const unsigned int* viewStarts;
+const unsigned int* viewOffsets;
+const unsigned int* viewOrder;
+const char* viewBytes;
+unsigned int viewTokenCount;
+unsigned int viewDocumentCount;
+unsigned int viewVocabularyCount;
+
+// X-----------------------X
+// |    #isViewAttached    |
+// X-----------------------X
+// Description: Whether the archive reads a mapped index rather than its own storage
+// Invariants:  The stored fields are empty while true, and no write is made
+bool isViewAttached;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------------------X
+// |    #getDocumentEnd(unsigned int)    |
+// X-------------------------------------X
+// Description:      Returns one past the last position of the document holding somePosition
+// Parameters:       somePosition - A token position
+// Preconditions:    somePosition < getTokenCount()
+// Postconditions:   None
+// Return value:     A token position, at most getTokenCount()
+// Functions called: getDocumentOf()
+unsigned int getDocumentEnd(unsigned int somePosition) const;
+
+// X--------------------------------------------X
+// |    #appendWordTo(string&, unsigned int)    |
+// X--------------------------------------------X
+// Description:      Appends the word an ID stands for to a string, from the vocabulary or the view
+// Parameters:       someString - String to extend
+//                   someWordID - A word ID
+// Preconditions:    None
+// Postconditions:   someString is unchanged if someWordID is out of range
+// Return value:     None
+// Functions called: string::append()
+void appendWordTo(string& someString, unsigned int someWordID) const;
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #beginDocument()    |
+// X------------------------X
+// Description:      Marks the start of a new document at the next token position
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   getDocumentCount() grows by one
+// Return value:     The new document's ID
+// Functions called: vector::push_back()
+unsigned int beginDocument();
+
+// X-----------------------X
+// |    #append(string)    |
+// X-----------------------X
+// Description:      Interns a word and stores it at the next token position
+// Parameters:       aWord - A cleaned, lowercased corpus word
+// Preconditions:    beginDocument() has been called at least once
+// Postconditions:   getTokenCount() grows by one
+// Return value:     The token position assigned to aWord
+// Functions called: intern(), vector::push_back()
+unsigned int append(const string& aWord);
+
+// X-------------------------------X
+// |    #appendID(unsigned int)    |
+// X-------------------------------X
+// Description:      Stores an already interned word at the next token position
+// Parameters:       someWordID - A word ID below getVocabularySize()
+// Preconditions:    beginDocument() has been called at least once
+// Postconditions:   getTokenCount() grows by one
+// Return value:     The token position assigned
+// Functions called: vector::push_back()
+unsigned int appendID(unsigned int someWordID);
+
+// X-----------------------X
+// |    #intern(string)    |
+// X-----------------------X
+// Description:      Returns the word ID of aWord, assigning a new one if it is unseen
+// Parameters:       aWord - Any word
+// Preconditions:    None
+// Postconditions:   aWord is in the vocabulary
+// Return value:     The word ID
+// Functions called: unordered_map::find()
+unsigned int intern(const string& aWord);
+
+// X------------------------------------------X
+// |    #findWordID(string, unsigned int&)    |
+// X------------------------------------------X
+// Description:      Looks a word up without interning it
+// Parameters:       aWord - Any word
+//                   someWordID - Receives the word ID if aWord is in the vocabulary
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     false if aWord has never been interned
+// Functions called: unordered_map::find()
+bool findWordID(const string& aWord, unsigned int& someWordID) const;
+
+// X------------------------------X
+// |    #getWord(unsigned int)    |
+// X------------------------------X
+// Description:      Returns the word stored at a token position
+// Parameters:       somePosition - Token position
+// Preconditions:    somePosition < getTokenCount()
+// Return value:     The word
+string getWord(unsigned int somePosition) const;
+
+// X--------------------------------X
+// |    #getWordID(unsigned int)    |
+// X--------------------------------X
+// Description:      Returns the interned ID of the word stored at a token position
+// Parameters:       somePosition - Token position
+// Preconditions:    somePosition < getTokenCount()
+// Return value:     0 to getVocabularySize() - 1. Equal words share one ID.
+unsigned int getWordID(unsigned int somePosition) const;
+
+// X----------------------------------------X
+// |    #getVocabularyWord(unsigned int)    |
+// X----------------------------------------X
+// Description:      Returns the word an interned ID stands for
+// Parameters:       someWordID - A word ID
+// Preconditions:    someWordID < getVocabularySize()
+// Return value:     The word
+string getVocabularyWord(unsigned int someWordID) const;
+
+// X-----------------------------------------X
+// |    #getVocabularyEntry(unsigned int)    |
+// X-----------------------------------------X
+// Description:      Returns the stored word an interned ID stands for without copying it, for a key that
+//                   borrows the archive's copy (LinkedListContext::KeyKeyword)
+// Parameters:       someWordID - A word ID
+// Preconditions:    someWordID < getVocabularySize(), and isView() is false
+// Return value:     The word. Stays valid as the archive grows: the vocabulary never moves.
+const string& getVocabularyEntry(unsigned int someWordID) const;
+
+// X------------------------------------X
+// |    #getDocumentOf(unsigned int)    |
+// X------------------------------------X
+// Description:      Returns the document holding a token position
+// Parameters:       somePosition - Token position
+// Preconditions:    getDocumentCount() > 0
+// Return value:     A document ID
+// Functions called: None
+unsigned int getDocumentOf(unsigned int somePosition) const;
+
+// X---------------------------------------X
+// |    #getDocumentStart(unsigned int)    |
+// X---------------------------------------X
+// Description:      Returns the first token position of a document
+// Parameters:       someDocumentID - A document ID
+// Preconditions:    someDocumentID < getDocumentCount()
+// Return value:     A token position, at most getTokenCount()
+// Functions called: None
+unsigned int getDocumentStart(unsigned int someDocumentID) const;
+
+// X--------------------------------------------------X
+// |    #getWindowHash(unsigned int, unsigned int)    |
+// X--------------------------------------------------X
+// Description:      Hashes the window around a keyword: the keyword's words and five words either side of
+//                   them, within its document
+// Parameters:       somePosition - Token position of the keyword's first word
+//                   someSpan - Words in the keyword, ie. 1, or n for an n-gram
+// Preconditions:    somePosition < getTokenCount(), and the five words after the keyword have been
+//                   appended or its document has ended
+// Return value:     Equal for positions whose contexts render identically in the same document
+// Functions called: getDocumentOf(), getDocumentEnd()
+unsigned long long getWindowHash(unsigned int somePosition, unsigned int someSpan) const;
+
+// X---------------------------------------------------------------X
+// |    #isSameWindow(unsigned int, unsigned int, unsigned int)    |
+// X---------------------------------------------------------------X
+// Description:      Compares the windows around two keywords word by word, settling a hash match
+// Parameters:       somePosition, otherPosition - Token positions of two keywords' first words
+//                   someSpan - Words in each keyword
+// Preconditions:    As getWindowHash(), for both
+// Return value:     true if both lie in the same document and their windows hold the same words
+// Functions called: getDocumentOf(), getDocumentEnd()
+bool isSameWindow(unsigned int somePosition, unsigned int otherPosition, unsigned int someSpan) const;
+
+// X-------------------------------------X
+// |    #getPrevContext(unsigned int)    |
+// X-------------------------------------X
+// Description:      Rebuilds the five words before a position exactly as ReaderCorpus formats them:
+//                   each word followed by a space, with "" for slots before the document start
+// Parameters:       somePosition - Token position of the keyword
+// Preconditions:    somePosition < getTokenCount()
+// Return value:     The previous context string
+string getPrevContext(unsigned int somePosition) const;
+
+// X-------------------------------------X
+// |    #getPostContext(unsigned int)    |
+// X-------------------------------------X
+// Description:      Rebuilds the five words after a position exactly as ReaderCorpus formats them:
+//                   each word preceded by a space, with " " for slots past the document end
+// Parameters:       somePosition - Token position of the keyword
+// Preconditions:    somePosition < getTokenCount()
+// Return value:     The post context string
+string getPostContext(unsigned int somePosition) const;
+
+// X-----------------------X
+// |    #save(ostream&)    |
+// X-----------------------X
+// Description:      Writes the vocabulary, the tokens and the document starts as whitespace-separated text
+// Parameters:       someStream - An open output stream
+// Preconditions:    None
+// Postconditions:   load() on the written text rebuilds an identical archive, word IDs included
+// Return value:     true if every write succeeded
+// Functions called: None
+bool save(ostream& someStream) const;
+
+// X-----------------------X
+// |    #load(istream&)    |
+// X-----------------------X
+// Description:      Reads an archive written by save()
+// Parameters:       someStream - An open input stream positioned at the saved archive
+// Preconditions:    The archive is empty
+// Postconditions:   On success, positions, word IDs and document IDs are those of the saved archive,
+//                   and later append() and beginDocument() calls continue from its end
+// Return value:     false if the text is truncated or malformed; the archive is then partly filled
+// Functions called: intern(), beginDocument()
+bool load(istream& someStream);
+
+// X-----------------------------------------------------X
+// |    #attachView(unsigned int*, unsigned int, ...)    |
+// X-----------------------------------------------------X
+// Description:      Makes an empty archive a read-only view of a mapped index's arrays, so that its positions
+//                   render without copying a token or interning a word. O(1).
+// Parameters:       someTokens, someTokenCount - Word ID at each position
+//                   someStarts, someDocumentCount - First position of each document, ascending
+//                   someOffsets, someBytes, someOrder, someVocabularyCount - The words, as for viewOffsets
+// Preconditions:    The arrays are valid as their invariants state, and outlive the archive
+// Postconditions:   Only the reading methods may be called
+// Return value:     false if the archive is not empty
+// Functions called: None
+bool attachView(const unsigned int* someTokens, unsigned int someTokenCount, const unsigned int* someStarts, unsigned int someDocumentCount,
+                const unsigned int* someOffsets, const char* someBytes, const unsigned int* someOrder, unsigned int someVocabularyCount);
+
+// X------------------------------------X
+// |    #discardBefore(unsigned int)    |
+// X------------------------------------X
+// Description:      Discards the tokens before a position, and every word no later token uses, so that an archive
+//                   read through a sliding window stays bounded. Positions are renumbered to start at 0.
+// Parameters:       someShift - First position to keep. Every later position p becomes p - someShift.
+// Preconditions:    No reader is using the archive. Every stored position below someShift is no longer needed.
+// Postconditions:   Word IDs are renumbered too. A document starting before someShift now starts at 0.
+// Return value:     None
+// Functions called: VectorChunked::swap()
+void discardBefore(unsigned int someShift);
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #ArchiveCorpus()    |
+// X------------------------X
+// Default constructor. Makes an empty archive with no documents.
+ArchiveCorpus();
+
+// X-------------------------X
+// |    #~ArchiveCorpus()    |
+// X-------------------------X
+// Destructor. Frees the token and vocabulary storage.
+~ArchiveCorpus();
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #getTokenCount()    |
+// X------------------------X
+// Description:      Returns the number of token positions stored
+unsigned int getTokenCount() const;
+
+// X---------------------------X
+// |    #getDocumentCount()    |
+// X---------------------------X
+// Description:      Returns the number of documents begun
+unsigned int getDocumentCount() const;
+
+// X----------------------------X
+// |    #getVocabularySize()    |
+// X----------------------------X
+// Description:      Returns the number of distinct words stored
+unsigned int getVocabularySize() const;
+
+// X-----------------X
+// |    #isView()    |
+// X-----------------X
+// Description:      Returns whether the archive reads a mapped index (attachView()) rather than its own storage
+bool isView() const;
+
+}; // Closing class ArchiveCorpus
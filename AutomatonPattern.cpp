@@ -0,0 +1,572 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// IndexSuffix.h
+// IndexSuffix.cpp
+// AutomatonPattern.h
+// AutomatonPattern.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for string operations (the pattern and the keywords tested)
+#include <string>
+
+// Necessary for vector operations (the automaton's states and the state sets)
+#include <vector>
+
+// Necessary for bitset operations (the characters each state accepts)
+#include <bitset>
+
+// Necessary for thread operations (testing a large dictionary in parallel)
+#include <thread>
+
+// Field and method declarations for the AutomatonPattern class
+#include "AutomatonPattern.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------------X
+// |    #addState(bitset<256>)    |
+// X------------------------------X
+// Appends a state with both moves unset
+int AutomatonPattern::addState(const bitset<256>& someChars) {
+   StatePattern newState;
+   newState.acceptedChars = someChars;
+   newState.nextState = -1;
+   newState.altState = -1;
+   patternStates.push_back(newState);
+   return(patternStates.size() - 1);
+}
+
+// X-------------------------------X
+// |    #makeChars(bitset<256>)    |
+// X-------------------------------X
+// A character state leading to an open epsilon exit
+AutomatonPattern::FragmentPattern AutomatonPattern::makeChars(const bitset<256>& someChars) {
+   FragmentPattern retPiece;
+   retPiece.startState = addState(someChars);
+   retPiece.endState = addState(bitset<256>());
+   patternStates[retPiece.startState].nextState = retPiece.endState;
+   return(retPiece);
+}
+
+// X------------------------------------------X
+// |    #makeRepeat(FragmentPattern, char)    |
+// X------------------------------------------X
+// "*" and "?" add an entry that may skip the piece; "*" and "+" let its exit loop back to its entry
+AutomatonPattern::FragmentPattern AutomatonPattern::makeRepeat(FragmentPattern somePiece, char someRepeat) {
+   FragmentPattern retPiece;
+   retPiece.endState = addState(bitset<256>());
+   if (someRepeat == '+') {
+      retPiece.startState = somePiece.startState;
+   }
+   else {
+      retPiece.startState = addState(bitset<256>());
+      patternStates[retPiece.startState].nextState = somePiece.startState;
+      patternStates[retPiece.startState].altState = retPiece.endState;
+   }
+   if (someRepeat == '?') {
+      patternStates[somePiece.endState].nextState = retPiece.endState;
+   }
+   else {
+      patternStates[somePiece.endState].nextState = somePiece.startState;
+      patternStates[somePiece.endState].altState = retPiece.endState;
+   }
+   return(retPiece);
+}
+
+// X---------------------------X
+// |    #parseAlternation()    |
+// X---------------------------X
+// Each "|" joins the branches so far and the next one under a new entry and a shared exit
+AutomatonPattern::FragmentPattern AutomatonPattern::parseAlternation() {
+   FragmentPattern retPiece = parseBranch();
+   while (retPiece.startState != -1 && parseIndex < patternText.length() && patternText[parseIndex] == '|') {
+      parseIndex++;
+      FragmentPattern nextBranch = parseBranch();
+      if (nextBranch.startState == -1) {
+         return(nextBranch);
+      }
+      FragmentPattern joinedPiece;
+      joinedPiece.startState = addState(bitset<256>());
+      joinedPiece.endState = addState(bitset<256>());
+      patternStates[joinedPiece.startState].nextState = retPiece.startState;
+      patternStates[joinedPiece.startState].altState = nextBranch.startState;
+      patternStates[retPiece.endState].nextState = joinedPiece.endState;
+      patternStates[nextBranch.endState].nextState = joinedPiece.endState;
+      retPiece = joinedPiece;
+   }
+   return(retPiece);
+}
+
+// X----------------------X
+// |    #parseBranch()    |
+// X----------------------X
+// Chains each atom, with its repeats, onto the exit of the branch so far
+AutomatonPattern::FragmentPattern AutomatonPattern::parseBranch() {
+   FragmentPattern retPiece;
+   retPiece.startState = addState(bitset<256>());
+   retPiece.endState = retPiece.startState;
+   FragmentPattern failedPiece = { -1, -1 };
+   while (parseIndex < patternText.length() && patternText[parseIndex] != '|' && patternText[parseIndex] != ')') {
+      char thisChar = patternText[parseIndex++];
+      FragmentPattern thisPiece;
+      bitset<256> thisChars;
+      if (thisChar == '(') {
+         thisPiece = parseAlternation();
+         if (thisPiece.startState == -1 || parseIndex >= patternText.length() || patternText[parseIndex] != ')') {
+            return(failedPiece);
+         }
+         parseIndex++;
+      }
+      else if (thisChar == '*' || thisChar == '+' || thisChar == '?') {
+         return(failedPiece);
+      }
+      else {
+         if (thisChar == '[') {
+            thisChars = parseClass();
+         }
+         else if (thisChar == '.') {
+            thisChars.set();
+         }
+         else if (thisChar == '\\') {
+            if (parseIndex < patternText.length()) {
+               thisChars.set((unsigned char)patternText[parseIndex++]);
+            }
+         }
+         else {
+            thisChars.set((unsigned char)thisChar);
+         }
+         if (thisChars.none()) {
+            return(failedPiece);
+         }
+         thisPiece = makeChars(thisChars);
+      }
+      while (parseIndex < patternText.length() && (patternText[parseIndex] == '*' || patternText[parseIndex] == '+' || patternText[parseIndex] == '?')) {
+         thisPiece = makeRepeat(thisPiece, patternText[parseIndex++]);
+      }
+      patternStates[retPiece.endState].nextState = thisPiece.startState;
+      retPiece.endState = thisPiece.endState;
+   }
+   return(retPiece);
+}
+
+// X---------------------X
+// |    #parseClass()    |
+// X---------------------X
+// A "]" first in the class, or "-" first or last, is literal. "^" first negates the class.
+bitset<256> AutomatonPattern::parseClass() {
+   bitset<256> retChars;
+   bool isNegated = (parseIndex < patternText.length() && patternText[parseIndex] == '^');
+   if (isNegated) {
+      parseIndex++;
+   }
+   size_t classStart = parseIndex;
+   while (parseIndex < patternText.length() && (patternText[parseIndex] != ']' || parseIndex == classStart)) {
+      unsigned char lowChar = patternText[parseIndex++];
+      unsigned char highChar = lowChar;
+      if (parseIndex + 1 < patternText.length() && patternText[parseIndex] == '-' && patternText[parseIndex + 1] != ']') {
+         highChar = patternText[parseIndex + 1];
+         parseIndex = parseIndex + 2;
+      }
+      for (unsigned int c = lowChar ; c <= highChar ; c++) {
+         retChars.set(c);
+      }
+   }
+   // Unterminated
+   if (parseIndex >= patternText.length()) {
+      return(bitset<256>());
+   }
+   parseIndex++;
+   return(isNegated ? ~retChars : retChars);
+}
+
+// X---------------------------------------------X
+// |    #addClosure(int, vector<int>, vector)    |
+// X---------------------------------------------X
+// Depth-first over the epsilon moves with an explicit stack, so a long pattern cannot exhaust the call stack
+void AutomatonPattern::addClosure(int someState, vector<int>& someSet, vector<unsigned int>& someMarks, unsigned int someGeneration) const {
+   vector<int> pendingStates(1, someState);
+   while (!pendingStates.empty()) {
+      int thisState = pendingStates.back();
+      pendingStates.pop_back();
+      if (thisState == -1 || someMarks[thisState] == someGeneration) {
+         continue;
+      }
+      someMarks[thisState] = someGeneration;
+      someSet.push_back(thisState);
+      if (patternStates[thisState].acceptedChars.none()) {
+         pendingStates.push_back(patternStates[thisState].altState);
+         pendingStates.push_back(patternStates[thisState].nextState);
+      }
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------X
+// |    #compileWildcard(string)    |
+// X--------------------------------X
+// "*" is any character repeated, "?" any one character, and everything else itself
+bool AutomatonPattern::compileWildcard(const string& somePattern) {
+   patternStates.clear();
+   bitset<256> anyChar;
+   anyChar.set();
+   FragmentPattern wholePiece;
+   wholePiece.startState = addState(bitset<256>());
+   wholePiece.endState = wholePiece.startState;
+   for (size_t i = 0 ; i < somePattern.length() ; i++) {
+      FragmentPattern thisPiece;
+      if (somePattern[i] == '*') {
+         thisPiece = makeRepeat(makeChars(anyChar), '*');
+      }
+      else if (somePattern[i] == '?') {
+         thisPiece = makeChars(anyChar);
+      }
+      else {
+         bitset<256> thisChars;
+         thisChars.set((unsigned char)somePattern[i]);
+         thisPiece = makeChars(thisChars);
+      }
+      patternStates[wholePiece.endState].nextState = thisPiece.startState;
+      wholePiece.endState = thisPiece.endState;
+   }
+   startState = wholePiece.startState;
+   acceptState = wholePiece.endState;
+   return(true);
+}
+
+// X-----------------------------X
+// |    #compileRegex(string)    |
+// X-----------------------------X
+// The whole pattern is one alternation; anything left unread after it is an unmatched ")"
+bool AutomatonPattern::compileRegex(const string& somePattern) {
+   patternStates.clear();
+   patternText = somePattern;
+   parseIndex = 0;
+   FragmentPattern wholePiece = parseAlternation();
+   if (wholePiece.startState == -1 || parseIndex != patternText.length()) {
+      patternStates.clear();
+      return(false);
+   }
+   startState = wholePiece.startState;
+   acceptState = wholePiece.endState;
+   return(true);
+}
+
+// X------------------------X
+// |    #matches(string)    |
+// X------------------------X
+// Steps the whole set of live states across the keyword, one character at a time
+bool AutomatonPattern::matches(const string& someKeyword) const {
+   if (patternStates.empty()) {
+      return(false);
+   }
+   vector<unsigned int> stateMarks(patternStates.size(), 0);
+   unsigned int thisGeneration = 1;
+   vector<int> liveStates;
+   vector<int> nextStates;
+   addClosure(startState, liveStates, stateMarks, thisGeneration);
+   for (size_t i = 0 ; i < someKeyword.length() && !liveStates.empty() ; i++) {
+      thisGeneration++;
+      nextStates.clear();
+      for (unsigned int j = 0 ; j < liveStates.size() ; j++) {
+         if (patternStates[liveStates[j]].acceptedChars.test((unsigned char)someKeyword[i])) {
+            addClosure(patternStates[liveStates[j]].nextState, nextStates, stateMarks, thisGeneration);
+         }
+      }
+      liveStates.swap(nextStates);
+   }
+   return(!liveStates.empty() && stateMarks[acceptState] == thisGeneration);
+}
+
+// X----------------------------------------X
+// |    #matchAll(vector<const string*>)    |
+// X----------------------------------------X
+// One contiguous slice of the keywords per hardware thread; small dictionaries are tested in place
+vector<char> AutomatonPattern::matchAll(const vector<const string*>& someKeywords) const {
+   vector<char> retMatches(someKeywords.size(), 0);
+   auto matchSlice = [&](size_t firstIndex, size_t endIndex) {
+      for (size_t i = firstIndex ; i < endIndex ; i++) {
+         retMatches[i] = this->matches(*someKeywords[i]);
+      }
+   };
+   size_t sliceCount = thread::hardware_concurrency();
+   if (sliceCount < 2 || someKeywords.size() < 4096) {
+      matchSlice(0, someKeywords.size());
+      return(retMatches);
+   }
+   vector<thread> sliceThreads;
+   size_t sliceLength = (someKeywords.size() + sliceCount - 1) / sliceCount;
+   for (size_t firstIndex = 0 ; firstIndex < someKeywords.size() ; firstIndex = firstIndex + sliceLength) {
+      sliceThreads.push_back(thread(matchSlice, firstIndex, min(firstIndex + sliceLength, someKeywords.size())));
+   }
+   for (unsigned int i = 0 ; i < sliceThreads.size() ; i++) {
+      sliceThreads[i].join();
+   }
+   return(retMatches);
+}
+
+// X---------------------------X
+// |    #getLiteralPrefix()    |
+// X---------------------------X
+// Follows the automaton while every live state reads the same single character and none accepts
+string AutomatonPattern::getLiteralPrefix() const {
+   string retPrefix = "";
+   if (patternStates.empty()) {
+      return(retPrefix);
+   }
+   vector<unsigned int> stateMarks(patternStates.size(), 0);
+   unsigned int thisGeneration = 1;
+   vector<int> liveStates;
+   addClosure(startState, liveStates, stateMarks, thisGeneration);
+   while (stateMarks[acceptState] != thisGeneration) {
+      int onlyChar = -1;
+      vector<int> nextStates;
+      thisGeneration++;
+      for (unsigned int j = 0 ; j < liveStates.size() ; j++) {
+         const StatePattern& thisState = patternStates[liveStates[j]];
+         if (thisState.acceptedChars.none()) {
+            continue;
+         }
+         if (thisState.acceptedChars.count() != 1) {
+            return(retPrefix);
+         }
+         int thisChar = 0;
+         while (!thisState.acceptedChars.test(thisChar)) {
+            thisChar++;
+         }
+         if (onlyChar != -1 && thisChar != onlyChar) {
+            return(retPrefix);
+         }
+         onlyChar = thisChar;
+         addClosure(thisState.nextState, nextStates, stateMarks, thisGeneration);
+      }
+      if (onlyChar == -1) {
+         return(retPrefix);
+      }
+      retPrefix = retPrefix + (char)onlyChar;
+      liveStates.swap(nextStates);
+   }
+   return(retPrefix);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------X
+// |    #AutomatonPattern()    |
+// X---------------------------X
+// Nothing compiled: every keyword fails to match
+AutomatonPattern::AutomatonPattern() {
+   startState = -1;
+   acceptState = -1;
+   parseIndex = 0;
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #getStateCount()    |
+// X------------------------X
+// Returns the automaton's states
+unsigned int AutomatonPattern::getStateCount() const {
+   return(patternStates.size());
+}
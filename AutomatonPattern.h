@@ -0,0 +1,442 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// IndexSuffix.h
+// IndexSuffix.cpp
+// AutomatonPattern.h
+// AutomatonPattern.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for string operations (the pattern and the keywords tested)
+#include <string>
+
+// Necessary for vector operations (the automaton's states)
+#include <vector>
+
+// Necessary for bitset operations (the characters each state accepts)
+#include <bitset>
+
+using namespace std;
+
+// X-------------------------X
+// |    #AutomatonPattern    |
+// X-------------------------X
+// Description: A wildcard or regular expression compiled to a nondeterministic automaton (Thompson, 1968)
+//              and tested against whole keywords. A wildcard takes "*" for any run of characters and "?"
+//              for any one. A regular expression takes literals, ".", classes ("[a-z]", "[^aeiou]"),
+//              grouping, "|", and the "*", "+" and "?" repeats; "\" makes the next character literal.
+//              Either must match the entire keyword. A keyword is tested by carrying the set of states
+//              it could be in across its characters, so a test costs O(length * states) however the
+//              pattern is written, with no backtracking. The literal text every match must start with is
+//              read off the automaton, so a sorted dictionary need only be searched under that prefix.
+class AutomatonPattern {
+
+private:
+// X---------------------X
+// |    #StatePattern    |
+// X---------------------X
+// Description: One automaton state. A state accepting no character is an epsilon state, moving to
+//              nextState and altState without reading; any other moves to nextState on a character it
+//              accepts. -1 is no state.
+// Invariants:  A character state's altState is -1
+struct StatePattern {
+   bitset<256> acceptedChars;
+   int nextState;
+   int altState;
+};
+
+// X------------------------X
+// |    #FragmentPattern    |
+// X------------------------X
+// Description: A piece of the automaton under construction: its entry state, and its exit, an epsilon
+//              state whose nextState is left at -1 until the piece is joined to what follows it
+// Invariants:  None
+struct FragmentPattern {
+   int startState;
+   int endState;
+};
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------X
+// |    #patternStates    |
+// X----------------------X
+// Description: The automaton, entered at startState and accepting in acceptState
+// Invariants:  Empty until a pattern compiles
+vector<StatePattern> patternStates;
+int startState;
+int acceptState;
+
+// X--------------------X
+// |    #patternText    |
+// X--------------------X
+// Description: The pattern being parsed, and the index of its next unread character
+// Invariants:  parseIndex <= patternText.length()
+string patternText;
+size_t parseIndex;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------------X
+// |    #addState(bitset<256>)    |
+// X------------------------------X
+// Description:      Appends a state with no moves yet
+// Parameters:       someChars - Characters the state accepts, none for an epsilon state
+// Preconditions:    None
+// Postconditions:   patternStates grows by one
+// Return value:     The new state's index
+// Functions called: None
+int addState(const bitset<256>& someChars);
+
+// X-------------------------------X
+// |    #makeChars(bitset<256>)    |
+// X-------------------------------X
+// Description:      Builds a piece reading one character from a set
+// Parameters:       someChars - Characters accepted
+// Preconditions:    someChars is not empty
+// Postconditions:   Two states are added
+// Return value:     The piece
+// Functions called: addState()
+FragmentPattern makeChars(const bitset<256>& someChars);
+
+// X------------------------------------------X
+// |    #makeRepeat(FragmentPattern, char)    |
+// X------------------------------------------X
+// Description:      Wraps a piece in a repeat
+// Parameters:       somePiece - The piece repeated
+//                   someRepeat - '*' for zero or more, '+' for one or more, '?' for zero or one
+// Preconditions:    None
+// Postconditions:   Up to two states are added
+// Return value:     The wrapped piece
+// Functions called: addState()
+FragmentPattern makeRepeat(FragmentPattern somePiece, char someRepeat);
+
+// X---------------------------X
+// |    #parseAlternation()    |
+// X---------------------------X
+// Description:      Parses branches separated by "|", up to the end of the pattern or an unmatched ")"
+// Parameters:       None
+// Preconditions:    parseIndex is at the first character of the alternation
+// Postconditions:   parseIndex is past the alternation
+// Return value:     The alternation's piece, or a startState of -1 on a syntax error
+// Functions called: parseBranch()
+FragmentPattern parseAlternation();
+
+// X----------------------X
+// |    #parseBranch()    |
+// X----------------------X
+// Description:      Parses a sequence of repeated atoms, up to "|", ")" or the end of the pattern
+// Parameters:       None
+// Preconditions:    parseIndex is at the first character of the branch
+// Postconditions:   parseIndex is past the branch
+// Return value:     The branch's piece (an empty branch matches the empty string), or a startState of
+//                   -1 on a syntax error
+// Functions called: parseAlternation(), parseClass(), makeChars(), makeRepeat()
+FragmentPattern parseBranch();
+
+// X---------------------X
+// |    #parseClass()    |
+// X---------------------X
+// Description:      Parses a bracketed class such as "[a-z]" or "[^aeiou]"
+// Parameters:       None
+// Preconditions:    parseIndex is just past the "["
+// Postconditions:   parseIndex is past the closing "]"
+// Return value:     The characters the class accepts, none if it is unterminated
+// Functions called: None
+bitset<256> parseClass();
+
+// X---------------------------------------------X
+// |    #addClosure(int, vector<int>, vector)    |
+// X---------------------------------------------X
+// Description:      Adds a state, and every state reachable from it without reading, to a state set
+// Parameters:       someState - The state reached
+//                   someSet - The set, as a list of states
+//                   someMarks - Per state, the generation that last added it
+//                   someGeneration - The current set's generation
+// Preconditions:    someMarks holds one entry per state
+// Postconditions:   Each state is listed at most once per generation
+// Return value:     None
+// Functions called: None
+void addClosure(int someState, vector<int>& someSet, vector<unsigned int>& someMarks, unsigned int someGeneration) const;
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------X
+// |    #compileWildcard(string)    |
+// X--------------------------------X
+// Description:      Compiles a wildcard, replacing any pattern held
+// Parameters:       somePattern - Literals, "*" and "?", ie. "*ness"
+// Preconditions:    None
+// Postconditions:   matches() tests keywords against somePattern
+// Return value:     Always true: every wildcard is well formed
+// Functions called: makeChars(), makeRepeat()
+bool compileWildcard(const string& somePattern);
+
+// X-----------------------------X
+// |    #compileRegex(string)    |
+// X-----------------------------X
+// Description:      Compiles a regular expression, replacing any pattern held
+// Parameters:       somePattern - ie. "colou?r"
+// Preconditions:    None
+// Postconditions:   matches() tests keywords against somePattern, if it compiled
+// Return value:     false on a syntax error: an unmatched parenthesis, an unterminated class, a repeat
+//                   with nothing to repeat, or a trailing "\"
+// Functions called: parseAlternation()
+bool compileRegex(const string& somePattern);
+
+// X------------------------X
+// |    #matches(string)    |
+// X------------------------X
+// Description:      Tests whether the pattern matches the whole of a keyword. Safe to call from several
+//                   threads at once.
+// Parameters:       someKeyword - The keyword
+// Preconditions:    A pattern has compiled
+// Postconditions:   None
+// Return value:     true on a match
+// Functions called: addClosure()
+bool matches(const string& someKeyword) const;
+
+// X----------------------------------------X
+// |    #matchAll(vector<const string*>)    |
+// X----------------------------------------X
+// Description:      Tests many keywords, split across the hardware threads once there are enough of them
+// Parameters:       someKeywords - The keywords, pointed to where they are held rather than copied
+// Preconditions:    A pattern has compiled
+// Postconditions:   None
+// Return value:     One flag per keyword, nonzero where it matches
+// Functions called: matches(), std::thread
+vector<char> matchAll(const vector<const string*>& someKeywords) const;
+
+// X---------------------------X
+// |    #getLiteralPrefix()    |
+// X---------------------------X
+// Description:      Returns the text every match starts with: the characters the automaton must read,
+//                   one by one, before it has any choice to make
+// Parameters:       None
+// Preconditions:    A pattern has compiled
+// Postconditions:   None
+// Return value:     ie. "colo" for "colou?r", "" for "*ness"
+// Functions called: addClosure()
+string getLiteralPrefix() const;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------X
+// |    #AutomatonPattern()    |
+// X---------------------------X
+// Description:      Creates an empty pattern. compileWildcard() or compileRegex() fills it.
+AutomatonPattern();
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #getStateCount()    |
+// X------------------------X
+// Description:      Returns the automaton's states, 0 before a pattern compiles
+unsigned int getStateCount() const;
+
+}; // Closing class AutomatonPattern
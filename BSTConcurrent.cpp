@@ -0,0 +1,486 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for stable_sort() (ordering the pending batch)
+#include <algorithm>
+
+// Field and method declarations for the BSTConcurrent class
+#include "BSTConcurrent.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------------------X
+// |    #findNode(NodeShared*, typeL)    |
+// X-------------------------------------X
+// A single segment is handed out as it is, sharing ownership with the version
+template <class typeT, class typeK, class typeO>
+template <class typeL>
+shared_ptr<const typeT> BSTConcurrent<typeT, typeK, typeO>::findNode(const NodeShared* nodePtr, const typeL& someKey) {
+   typeK keyOf;
+   typeO compareKeys;
+   while (nodePtr != nullptr) {
+      const SegmentShared* segmentPtr = nodePtr->newestSegment.get();
+      int keyOrder = compareKeys(someKey, keyOf(segmentPtr->segmentData));
+      if (keyOrder == 0) {
+         if (segmentPtr->olderPtr == nullptr) {
+            return(shared_ptr<const typeT>(nodePtr->newestSegment, &segmentPtr->segmentData));
+         }
+         return(mergeSegments(segmentPtr));
+      }
+      nodePtr = (keyOrder < 0) ? nodePtr->leftPtr.get() : nodePtr->rightPtr.get();
+   }
+   return(nullptr);
+}
+
+// X--------------------------------------X
+// |    #mergeSegments(SegmentShared*)    |
+// X--------------------------------------X
+// The chain holds at most log2(batches) + 1 segments, so collecting them costs nothing next to the copy
+template <class typeT, class typeK, class typeO>
+shared_ptr<typeT> BSTConcurrent<typeT, typeK, typeO>::mergeSegments(const SegmentShared* segmentPtr) {
+   vector<const SegmentShared*> chainSegments;
+   while (segmentPtr != nullptr) {
+      chainSegments.push_back(segmentPtr);
+      segmentPtr = segmentPtr->olderPtr.get();
+   }
+   shared_ptr<typeT> mergedData = make_shared<typeT>();
+   for (size_t i = chainSegments.size() ; i > 0 ; i--) {
+      *mergedData = chainSegments[i - 1]->segmentData;
+   }
+   return(mergedData);
+}
+
+// X----------------------------------------------------------------------X
+// |    #traverseNode(NodeShared*, string, string, bool, bool, typeS&)    |
+// X----------------------------------------------------------------------X
+template <class typeT, class typeK, class typeO>
+template <class typeS>
+int BSTConcurrent<typeT, typeK, typeO>::traverseNode(const NodeShared* nodePtr, const string& lowValue, const string& highValue, bool highInclusive, bool highBounded, typeS& someSink) {
+   if (nodePtr == nullptr) {
+      return(0);
+   }
+   typeK keyOf;
+   typeO compareKeys;
+   int matchCount = 0;
+   const SegmentShared* segmentPtr = nodePtr->newestSegment.get();
+   int lowOrder = compareKeys(keyOf(segmentPtr->segmentData), lowValue);
+   int highOrder = -1;
+   if (highBounded) {
+      highOrder = compareKeys(keyOf(segmentPtr->segmentData), highValue);
+   }
+   if (lowOrder > 0) {
+      matchCount = matchCount + traverseNode(nodePtr->leftPtr.get(), lowValue, highValue, highInclusive, highBounded, someSink);
+   }
+   if (lowOrder >= 0 && (highOrder < 0 || (highOrder == 0 && highInclusive))) {
+      if (segmentPtr->olderPtr == nullptr) {
+         someSink(segmentPtr->segmentData);
+      }
+      else {
+         someSink(*mergeSegments(segmentPtr));
+      }
+      matchCount++;
+   }
+   if (highOrder < 0) {
+      matchCount = matchCount + traverseNode(nodePtr->rightPtr.get(), lowValue, highValue, highInclusive, highBounded, someSink);
+   }
+   return(matchCount);
+}
+
+// X-----------------------------------------X
+// |    #prefixSuccessor(string, string&)    |
+// X-----------------------------------------X
+template <class typeT, class typeK, class typeO>
+bool BSTConcurrent<typeT, typeK, typeO>::prefixSuccessor(const string& somePrefix, string& someSuccessor) {
+   someSuccessor = somePrefix;
+   // Trailing characters already at their maximum cannot be bumped, so drop them
+   while (!someSuccessor.empty() && (unsigned char)someSuccessor[someSuccessor.length() - 1] == 0xFF) {
+      someSuccessor.erase(someSuccessor.length() - 1);
+   }
+   if (someSuccessor.empty()) {
+      return(false);
+   }
+   someSuccessor[someSuccessor.length() - 1]++;
+   return(true);
+}
+
+// X--------------------------------------------X
+// |    #mergeNode(shared_ptr, typeT&, int&)    |
+// X--------------------------------------------X
+// The version being built is not yet visible to readers, but every node it shares with a published
+// version is, so nothing reachable from the old root is written: each node on the path is copied.
+template <class typeT, class typeK, class typeO>
+shared_ptr<const typename BSTConcurrent<typeT, typeK, typeO>::NodeShared> BSTConcurrent<typeT, typeK, typeO>::mergeNode(const shared_ptr<const NodeShared>& nodePtr, typeT& someData, int& entryCount) {
+   shared_ptr<NodeShared> copyPtr = make_shared<NodeShared>();
+   if (nodePtr == nullptr) {
+      copyPtr->newestSegment = pushSegment(nullptr, someData);
+      entryCount++;
+      return(copyPtr);
+   }
+   *copyPtr = *nodePtr;
+   int keyOrder = compareKeys(keyOf(someData), keyOf(nodePtr->newestSegment->segmentData));
+   if (keyOrder < 0) {
+      copyPtr->leftPtr = mergeNode(nodePtr->leftPtr, someData, entryCount);
+   }
+   else if (keyOrder > 0) {
+      copyPtr->rightPtr = mergeNode(nodePtr->rightPtr, someData, entryCount);
+   }
+   else {
+      // The published segments stay shared; the batch's entry goes on as the newest
+      copyPtr->newestSegment = pushSegment(nodePtr->newestSegment, someData);
+   }
+   return(copyPtr);
+}
+
+// X-----------------------------------------------------------------------X
+// |    #mergeRange(shared_ptr&, vector<typeT*>&, size_t, size_t, int&)    |
+// X-----------------------------------------------------------------------X
+template <class typeT, class typeK, class typeO>
+void BSTConcurrent<typeT, typeK, typeO>::mergeRange(shared_ptr<const NodeShared>& rootRef, vector<typeT*>& sortedEntries, size_t lowIndex, size_t highIndex, int& entryCount) {
+   if (lowIndex >= highIndex) {
+      return;
+   }
+   size_t midIndex = lowIndex + (highIndex - lowIndex) / 2;
+   rootRef = mergeNode(rootRef, *sortedEntries[midIndex], entryCount);
+   mergeRange(rootRef, sortedEntries, lowIndex, midIndex, entryCount);
+   mergeRange(rootRef, sortedEntries, midIndex + 1, highIndex, entryCount);
+}
+
+
+// X----------------------------------------X
+// |    #pushSegment(shared_ptr, typeT&)    |
+// X----------------------------------------X
+// Folding a newer segment onto a copy of the older one keeps each segment in corpus order. The
+// segments folded span no more batches than the new one, so a copy costs at most what it carries forward.
+template <class typeT, class typeK, class typeO>
+shared_ptr<const typename BSTConcurrent<typeT, typeK, typeO>::SegmentShared> BSTConcurrent<typeT, typeK, typeO>::pushSegment(const shared_ptr<const SegmentShared>& olderPtr, typeT& someData) {
+   shared_ptr<SegmentShared> newSegment = make_shared<SegmentShared>();
+   newSegment->segmentData = std::move(someData);
+   newSegment->olderPtr = olderPtr;
+   newSegment->batchCount = 1;
+   while (newSegment->olderPtr != nullptr && newSegment->olderPtr->batchCount <= newSegment->batchCount) {
+      const SegmentShared* foldedPtr = newSegment->olderPtr.get();
+      shared_ptr<SegmentShared> mergedSegment = make_shared<SegmentShared>();
+      mergedSegment->segmentData = foldedPtr->segmentData;
+      mergedSegment->segmentData = std::move(newSegment->segmentData);
+      mergedSegment->olderPtr = foldedPtr->olderPtr;
+      mergedSegment->batchCount = foldedPtr->batchCount + newSegment->batchCount;
+      newSegment = mergedSegment;
+   }
+   return(newSegment);
+}
+
+
+
+// X----------------------X
+// |    #notePending()    |
+// X----------------------X
+// The clock is read on every insert, so no batch outlives publishInterval by more than one insert's gap
+template <class typeT, class typeK, class typeO>
+bool BSTConcurrent<typeT, typeK, typeO>::notePending() {
+   insertCount.store(insertCount.load(memory_order_relaxed) + 1, memory_order_relaxed);
+   if (pendingEntries.size() == 1) {
+      pendingSince = chrono::steady_clock::now();
+   }
+   if (pendingEntries.size() >= publishEvery) {
+      return(publish());
+   }
+   if (chrono::steady_clock::now() - pendingSince >= publishInterval) {
+      return(publish());
+   }
+   return(false);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #insert(<typeT>)    |
+// X------------------------X
+template <class typeT, class typeK, class typeO>
+bool BSTConcurrent<typeT, typeK, typeO>::insert(typeT& someData) {
+   pendingEntries.emplace_back();
+   pendingEntries.back() = someData;
+   return(notePending());
+}
+
+// X--------------------------X
+// |    #insert(<typeT>&&)    |
+// X--------------------------X
+template <class typeT, class typeK, class typeO>
+bool BSTConcurrent<typeT, typeK, typeO>::insert(typeT&& someData) {
+   pendingEntries.push_back(std::move(someData));
+   return(notePending());
+}
+
+// X------------------X
+// |    #publish()    |
+// X------------------X
+template <class typeT, class typeK, class typeO>
+bool BSTConcurrent<typeT, typeK, typeO>::publish() {
+   if (pendingEntries.empty()) {
+      return(false);
+   }
+   // Order the batch by key; stable, so equal keys keep their arrival order
+   vector<typeT*> sortedEntries(pendingEntries.size());
+   for (size_t i = 0 ; i < pendingEntries.size() ; i++) {
+      sortedEntries[i] = &pendingEntries[i];
+   }
+   stable_sort(sortedEntries.begin(), sortedEntries.end(), [this](typeT* leftPtr, typeT* rightPtr) {
+      return(compareKeys(keyOf(*leftPtr), keyOf(*rightPtr)) < 0);
+   });
+   // Fold each run of equal keys into its first entry, as repeated inserts would
+   size_t keptCount = 0;
+   for (size_t i = 0 ; i < sortedEntries.size() ; i++) {
+      if (keptCount > 0 && compareKeys(keyOf(*sortedEntries[keptCount - 1]), keyOf(*sortedEntries[i])) == 0) {
+         *sortedEntries[keptCount - 1] = std::move(*sortedEntries[i]);
+      }
+      else {
+         sortedEntries[keptCount] = sortedEntries[i];
+         keptCount++;
+      }
+   }
+
+   shared_ptr<const VersionShared> currentVersion = atomic_load(&publishedVersion);
+   shared_ptr<VersionShared> nextVersion = make_shared<VersionShared>();
+   nextVersion->rootPtr = currentVersion->rootPtr;
+   nextVersion->entryCount = currentVersion->entryCount;
+   mergeRange(nextVersion->rootPtr, sortedEntries, 0, keptCount, nextVersion->entryCount);
+   nextVersion->insertCount = insertCount.load(memory_order_relaxed);
+   nextVersion->versionNumber = currentVersion->versionNumber + 1;
+   atomic_store(&publishedVersion, shared_ptr<const VersionShared>(nextVersion));
+   pendingEntries.clear();
+   return(true);
+}
+
+// X----------------------X
+// |    #getSnapshot()    |
+// X----------------------X
+template <class typeT, class typeK, class typeO>
+typename BSTConcurrent<typeT, typeK, typeO>::Snapshot BSTConcurrent<typeT, typeK, typeO>::getSnapshot() const {
+   return(Snapshot(atomic_load(&publishedVersion)));
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------X
+// |    #BSTConcurrent(unsigned int, int)    |
+// X-----------------------------------------X
+template <class typeT, class typeK, class typeO>
+BSTConcurrent<typeT, typeK, typeO>::BSTConcurrent(unsigned int somePublishEvery, int somePublishMillis) : insertCount(0), publishInterval(somePublishMillis) {
+   publishEvery = (somePublishEvery == 0) ? 1 : somePublishEvery;
+   shared_ptr<VersionShared> emptyVersion = make_shared<VersionShared>();
+   emptyVersion->entryCount = 0;
+   emptyVersion->insertCount = 0;
+   emptyVersion->versionNumber = 0;
+   publishedVersion = emptyVersion;
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------X
+// |    #getInsertCount()    |
+// X-------------------------X
+template <class typeT, class typeK, class typeO>
+unsigned long long BSTConcurrent<typeT, typeK, typeO>::getInsertCount() const {
+   return(insertCount.load(memory_order_relaxed));
+}
+
+// X--------------------------X
+// |    #getPendingCount()    |
+// X--------------------------X
+template <class typeT, class typeK, class typeO>
+int BSTConcurrent<typeT, typeK, typeO>::getPendingCount() const {
+   return(pendingEntries.size());
+}
@@ -0,0 +1,560 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for input-output operations (printout)
+#include <iostream>
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for vector operations (the pending batch)
+#include <vector>
+
+// Necessary for shared_ptr and its atomic load and store (published versions)
+#include <memory>
+
+// Necessary for the insert count read by other threads (atomic)
+#include <atomic>
+
+// Necessary for the time-based publishing bound
+#include <chrono>
+
+// Necessary for std::move and std::forward
+#include <utility>
+
+// Key and comparison policies shared with the BSTGeneric class (KeyIdentity, CompareThreeWay)
+#include "BSTGeneric.h"
+
+using namespace std;
+
+// X----------------------X
+// |    #BSTConcurrent    |
+// X----------------------X
+// Description: Generic binary search tree that one writer fills while any number of readers query it.
+//              Readers work on immutable snapshots: a published version is never modified, so a lookup or
+//              walk holds no lock and never waits on ingestion.
+//              The writer batches inserts and folds each batch into a new version by path copying. Only
+//              the nodes from the root down to each changed entry are copied, and the rest are shared with
+//              the previous version. The new root is then published with one atomic shared_ptr store.
+//              A version is freed once the last snapshot holding it is dropped, and nodes it shares live on
+//              in the newer versions.
+//              An entry is stored as a chain of segments, so a batch hitting a key adds a segment holding
+//              only what the batch brought, and the older segments are shared. A segment is folded into the
+//              one before it once it spans as many batches, as a binary counter carries; each occurrence is
+//              then copied O(log batches) times and an entry never has more than log2(batches) + 1 segments.
+//              Staleness is bounded: a batch is published once it holds publishEvery inserts, or once its
+//              oldest insert is publishInterval old, checked on every insert. A writer that pauses calls
+//              publish() itself.
+//              Snapshot entries render through the shared ArchiveCorpus, whose storage is append-only for
+//              this reason.
+//              typeK, typeO - Key and comparison policies, as for BSTGeneric
+template <class typeT, class typeK = KeyIdentity, class typeO = CompareThreeWay>
+class BSTConcurrent {
+
+protected:
+
+   // #SegmentShared - Part of an entry: what some run of batches added to its key. Immutable, and
+   //                  shared by every version whose entry reaches it.
+   struct SegmentShared {
+      typeT segmentData;
+      // #olderPtr - The segment added before this one, or nullptr
+      shared_ptr<const SegmentShared> olderPtr;
+      // #batchCount - Batches folded into segmentData. Strictly less than olderPtr->batchCount.
+      unsigned int batchCount;
+   };
+
+   // #NodeShared - A node of some published version. Immutable; its entry and subtrees may be shared
+   //               by several versions.
+   struct NodeShared {
+      // #newestSegment - The entry, as a chain of segments newest first. Never nullptr.
+      shared_ptr<const SegmentShared> newestSegment;
+      shared_ptr<const NodeShared> leftPtr;
+      shared_ptr<const NodeShared> rightPtr;
+   };
+
+   // #VersionShared - One published state of the tree
+   struct VersionShared {
+      shared_ptr<const NodeShared> rootPtr;
+      // #entryCount - Number of entries
+      int entryCount;
+      // #insertCount - Inserts folded in, over the tree's lifetime
+      unsigned long long insertCount;
+      // #versionNumber - 0 for the empty tree, one more for each publish
+      unsigned long long versionNumber;
+   };
+
+public:
+
+   // X-----------------X
+   // |    #Snapshot    |
+   // X-----------------X
+   // Description: Read-only view of one published version, consistent for as long as it is held.
+   //              Copyable and safe to use from any thread. An entry of several segments is handed out as
+//              a merged copy, built when it is visited.
+   class Snapshot {
+   private:
+      // #versionPtr - The version viewed, kept alive by this reference
+      shared_ptr<const VersionShared> versionPtr;
+   public:
+      Snapshot(const shared_ptr<const VersionShared>& someVersion) : versionPtr(someVersion) {
+      }
+      // #find(typeL) - Returns the entry with a key, or nullptr
+      template <class typeL>
+      shared_ptr<const typeT> find(const typeL& someKey) const {
+         return(findNode(versionPtr->rootPtr.get(), someKey));
+      }
+      // #traverseRange(string, string, typeS&) - Streams the entries with keys in [lowValue, highValue], in order
+      template <class typeS>
+      int traverseRange(const string& lowValue, const string& highValue, typeS& someSink) const {
+         return(traverseNode(versionPtr->rootPtr.get(), lowValue, highValue, true, true, someSink));
+      }
+      // #traversePrefix(string, typeS&) - Streams the entries whose key starts with somePrefix, in order
+      template <class typeS>
+      int traversePrefix(const string& somePrefix, typeS& someSink) const {
+         string successorValue;
+         bool highBounded = prefixSuccessor(somePrefix, successorValue);
+         return(traverseNode(versionPtr->rootPtr.get(), somePrefix, successorValue, false, highBounded, someSink));
+      }
+      // #printout() - Sends every entry to cout in order
+      void printout() const {
+         auto toConsole = [](const typeT& someData) { cout << someData; };
+         traversePrefix("", toConsole);
+      }
+      // #getSize() - Returns the number of entries
+      int getSize() const {
+         return(versionPtr->entryCount);
+      }
+      // #getInsertCount() - Returns the number of inserts this version holds
+      unsigned long long getInsertCount() const {
+         return(versionPtr->insertCount);
+      }
+      // #getVersion() - Returns the version number, 0 for the empty tree
+      unsigned long long getVersion() const {
+         return(versionPtr->versionNumber);
+      }
+   };
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------X
+// |    #publishedVersion    |
+// X-------------------------X
+// The latest version. Read and written only through atomic_load() and atomic_store().
+// Invariant information: Never nullptr
+shared_ptr<const VersionShared> publishedVersion;
+
+// X-----------------------X
+// |    #pendingEntries    |
+// X-----------------------X
+// Inserts not yet published, in arrival order. Writer only.
+// Invariant information: 
+vector<typeT> pendingEntries;
+
+// X---------------------X
+// |    #pendingSince    |
+// X---------------------X
+// When the oldest pending insert arrived. Writer only.
+// Invariant information: Meaningful while pendingEntries is non-empty
+chrono::steady_clock::time_point pendingSince;
+
+// X--------------------X
+// |    #insertCount    |
+// X--------------------X
+// Inserts accepted, published or not. Written by the writer, readable by any thread.
+// Invariant information: >= the insertCount of every published version
+atomic<unsigned long long> insertCount;
+
+// X---------------------X
+// |    #publishEvery    |
+// X---------------------X
+// Pending inserts that force a publish.
+// Invariant information: >= 1
+unsigned int publishEvery;
+
+// X------------------------X
+// |    #publishInterval    |
+// X------------------------X
+// Age of the oldest pending insert that forces a publish.
+// Invariant information: 
+chrono::milliseconds publishInterval;
+
+// X--------------X
+// |    #keyOf    |
+// X--------------X
+// Key policy instance.
+// Invariant information: 
+typeK keyOf;
+
+// X--------------------X
+// |    #compareKeys    |
+// X--------------------X
+// Comparison policy instance.
+// Invariant information: 
+typeO compareKeys;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// #findNode(NodeShared*, typeL) - Helper method
+// X-------------------------------------X
+// |    #findNode(NodeShared*, typeL)    |
+// X-------------------------------------X
+// Description:      Descends from a node to the entry with someKey
+// Parameters:       nodePtr - Root of the subtree, or nullptr
+//                   someKey - Key to look for
+// Return value:     The entry, or nullptr if absent
+// Functions called: mergeSegments()
+template <class typeL>
+static shared_ptr<const typeT> findNode(const NodeShared* nodePtr, const typeL& someKey);
+
+// #mergeSegments(SegmentShared*) - Helper method
+// X--------------------------------------X
+// |    #mergeSegments(SegmentShared*)    |
+// X--------------------------------------X
+// Description:      Assigns a chain's segments onto an empty entry, oldest first, as BSTGeneric::insert()
+//                   would on each hit
+// Parameters:       segmentPtr - Newest segment of the chain
+// Return value:     The whole entry
+static shared_ptr<typeT> mergeSegments(const SegmentShared* segmentPtr);
+
+// #traverseNode(NodeShared*, string, string, bool, bool, typeS&) - Recursive method
+// X----------------------------------------------------------------------X
+// |    #traverseNode(NodeShared*, string, string, bool, bool, typeS&)    |
+// X----------------------------------------------------------------------X
+// Description:      In-order walk restricted to the keys from lowValue up to highValue, entering a subtree
+//                   only when it can hold such keys, as BSTGeneric::traverseRange(nodePtr, ...) does
+// Parameters:       nodePtr - Root of the subtree, or nullptr
+//                   lowValue - Inclusive lower bound
+//                   highValue - Upper bound, ignored when highBounded is false
+//                   highInclusive - Whether a key equal to highValue matches
+//                   highBounded - Whether highValue applies at all
+//                   someSink - Callable receiving each matching const typeT&
+// Return value:     Number of entries sent to someSink
+template <class typeS>
+static int traverseNode(const NodeShared* nodePtr, const string& lowValue, const string& highValue, bool highInclusive, bool highBounded, typeS& someSink);
+
+// #prefixSuccessor(string, string&) - Helper method
+// X-----------------------------------------X
+// |    #prefixSuccessor(string, string&)    |
+// X-----------------------------------------X
+// Description:      Computes the least string above every string starting with somePrefix, as
+//                   BSTGeneric::traversePrefix() does ("inter" -> "intes")
+// Parameters:       somePrefix - The prefix
+//                   someSuccessor - Receives the successor
+// Return value:     false if there is none, ie. every key at or above somePrefix starts with it
+static bool prefixSuccessor(const string& somePrefix, string& someSuccessor);
+
+// #mergeNode(shared_ptr, typeT&, int&) - Recursive method
+// X--------------------------------------------X
+// |    #mergeNode(shared_ptr, typeT&, int&)    |
+// X--------------------------------------------X
+// Description:      Path copy: returns a copy of the subtree with someData moved in, or added as the newest
+//                   segment of the entry with the same key. Only the nodes on the search path are new.
+// Parameters:       nodePtr - Root of the subtree, or nullptr
+//                   someData - Pending entry, moved from
+//                   entryCount - Incremented when someData's key is new
+// Return value:     Root of the new subtree
+// Functions called: mergeNode(), pushSegment()
+shared_ptr<const NodeShared> mergeNode(const shared_ptr<const NodeShared>& nodePtr, typeT& someData, int& entryCount);
+
+// #mergeRange(shared_ptr&, vector<typeT*>&, size_t, size_t, int&) - Recursive method
+// X-----------------------------------------------------------------------X
+// |    #mergeRange(shared_ptr&, vector<typeT*>&, size_t, size_t, int&)    |
+// X-----------------------------------------------------------------------X
+// Description:      Merges a run of key-sorted entries, middle first and then each half the same way, so
+//                   a batch landing in an empty region of the tree comes out balanced, not as a sorted chain
+// Parameters:       rootRef - Root of the version under construction, replaced by each merge
+//                   sortedEntries - Pending entries in key order, one per key
+//                   lowIndex, highIndex - The run [lowIndex, highIndex)
+//                   entryCount - As for mergeNode()
+// Functions called: mergeNode(), mergeRange()
+void mergeRange(shared_ptr<const NodeShared>& rootRef, vector<typeT*>& sortedEntries, size_t lowIndex, size_t highIndex, int& entryCount);
+
+// #pushSegment(shared_ptr, typeT&) - Helper method
+// X----------------------------------------X
+// |    #pushSegment(shared_ptr, typeT&)    |
+// X----------------------------------------X
+// Description:      Makes a chain with someData as its newest segment, folding it into the older segments
+//                   that span no more batches than it does. Only the folded segments are copied.
+// Parameters:       olderPtr - Newest segment of the published chain, left unchanged
+//                   someData - One batch's entry for the chain's key, moved from
+// Return value:     Newest segment of the new chain
+// Functions called: None
+static shared_ptr<const SegmentShared> pushSegment(const shared_ptr<const SegmentShared>& olderPtr, typeT& someData);
+
+// #notePending() - Helper method
+// X----------------------X
+// |    #notePending()    |
+// X----------------------X
+// Description:      Counts an insert just queued, and publishes if the batch has reached either bound
+// Return value:     true if a version was published
+// Functions called: publish()
+bool notePending();
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #insert(<typeT>)    |
+// X------------------------X
+// Description:      Queues a copy of someData, publishing if the batch has reached either bound
+// Parameters:       someData - Entry to add, or to assign onto the entry with the same key
+// Preconditions:    Called from the writer thread only
+// Return value:     true if this insert published a version
+// Functions called: notePending()
+bool insert(typeT& someData);
+
+// X--------------------------X
+// |    #insert(<typeT>&&)    |
+// X--------------------------X
+// Description:      As insert(typeT&), but moves someData into the batch
+// Preconditions:    Called from the writer thread only
+// Return value:     true if this insert published a version
+// Functions called: notePending()
+bool insert(typeT&& someData);
+
+// X------------------X
+// |    #publish()    |
+// X------------------X
+// Description:      Folds the pending batch into a new version and makes it the one getSnapshot() returns.
+//                   Equal keys in the batch are assigned onto one another in arrival order first, then the
+//                   batch is merged in key order, so the result is that of inserting each in turn.
+// Preconditions:    Called from the writer thread only
+// Postconditions:   No inserts are pending
+// Return value:     true if there was anything to publish
+// Functions called: mergeRange(), stable_sort(), atomic_load(), atomic_store()
+bool publish();
+
+// X----------------------X
+// |    #getSnapshot()    |
+// X----------------------X
+// Description:      Returns a view of the latest published version. Safe from any thread.
+// Return value:     The snapshot
+// Functions called: atomic_load()
+Snapshot getSnapshot() const;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------X
+// |    #BSTConcurrent(unsigned int, int)    |
+// X-----------------------------------------X
+// Description:      Makes an empty tree, published as version 0
+// Parameters:       somePublishEvery - Pending inserts that force a publish, ie. 4096. 0 is raised to 1.
+//                   somePublishMillis - Age in milliseconds of the oldest pending insert that forces one
+BSTConcurrent(unsigned int somePublishEvery, int somePublishMillis);
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------X
+// |    #getInsertCount()    |
+// X-------------------------X
+// Description:      Returns the number of inserts accepted, published or not. Safe from any thread; the
+//                   difference from a snapshot's getInsertCount() is how stale that snapshot is.
+// Return value:     >= 0
+unsigned long long getInsertCount() const;
+
+// X--------------------------X
+// |    #getPendingCount()    |
+// X--------------------------X
+// Description:      Returns the number of inserts not yet published
+// Preconditions:    Called from the writer thread only
+// Return value:     >= 0
+int getPendingCount() const;
+
+}; // Closing class BSTConcurrent
@@ -184,7 +184,7 @@ using namespace std;
 // X-----------------X
 // String holding the name or identifier of this tree. Used for debugging.
 // Invariant information: 
-//     template <class typeT>
+//     template <class typeT, class typeK, class typeO>
 //     string treeData = "";
 
 // X----------------X
@@ -192,7 +192,7 @@ using namespace std;
 // X----------------X
 // NodeGeneric pointer to the root node of this tree.
 // Invariant information: 
-//     template <class typeT>
+//     template <class typeT, class typeK, class typeO>
 //     NodeGeneric<typeT>* rootPtr;
 
 
@@ -214,8 +214,8 @@ using namespace std;
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::deletePostOrder() {
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::deletePostOrder() {
    // Check for empty tree
    if (rootPtr == nullptr) {
       return (false);
@@ -236,8 +236,8 @@ bool BSTGeneric<typeT>::deletePostOrder() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::deletePostOrder(NodeGeneric<typeT>* thisNode) {
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::deletePostOrder(NodeGeneric<typeT>* thisNode) {
    // Left traverse
    if (thisNode->leftPtr != nullptr) {
       deletePostOrder(thisNode->leftPtr);
@@ -263,9 +263,12 @@ bool BSTGeneric<typeT>::deletePostOrder(NodeGeneric<typeT>* thisNode) {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-void BSTGeneric<typeT>::obliviate() {
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::obliviate() {
    deletePostOrder();
+   rootPtr = nullptr;
+   nodeCount = 0;
+   tombstoneCount = 0;
 }
 
 // #traversePreOrder() - Helper method
@@ -278,8 +281,8 @@ void BSTGeneric<typeT>::obliviate() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::traversePreOrder() {
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::traversePreOrder() {
    // Check for empty tree
    if (rootPtr == nullptr) {
       return (false);
@@ -300,8 +303,8 @@ bool BSTGeneric<typeT>::traversePreOrder() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::traversePreOrder(NodeGeneric<typeT>* thisNode) {
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::traversePreOrder(NodeGeneric<typeT>* thisNode) {
    visit(thisNode);
    if (thisNode->leftPtr != nullptr) {
       traversePreOrder(thisNode->leftPtr);
@@ -322,8 +325,8 @@ bool BSTGeneric<typeT>::traversePreOrder(NodeGeneric<typeT>* thisNode) {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::traverseInOrder() {
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::traverseInOrder() {
    // Check for empty tree
    if (rootPtr == nullptr) {
       return (false);
@@ -344,8 +347,8 @@ bool BSTGeneric<typeT>::traverseInOrder() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::traverseInOrder(NodeGeneric<typeT>* thisNode) {
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::traverseInOrder(NodeGeneric<typeT>* thisNode) {
    if (thisNode->leftPtr != nullptr) {
       traverseInOrder(thisNode->leftPtr);
    }
@@ -366,8 +369,8 @@ bool BSTGeneric<typeT>::traverseInOrder(NodeGeneric<typeT>* thisNode) {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::traversePostOrder() {
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::traversePostOrder() {
    // Check for empty tree
    if (rootPtr == nullptr) {
       return (false);
@@ -387,8 +390,8 @@ bool BSTGeneric<typeT>::traversePostOrder() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::traversePostOrder(NodeGeneric<typeT>* thisNode) {
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::traversePostOrder(NodeGeneric<typeT>* thisNode) {
    if (thisNode->leftPtr != nullptr) {
       traversePostOrder(thisNode->leftPtr);
    }
@@ -401,6 +404,318 @@ bool BSTGeneric<typeT>::traversePostOrder(NodeGeneric<typeT>* thisNode) {
    return(true);
 }
 
+// #traverseRange(nodePtr, string, string, bool, bool, typeS&) - Recursive method
+// X-----------------------------------------------------------------X
+// |    #traverseRange(nodePtr, string, string, bool, bool, typeS&)    |
+// X-----------------------------------------------------------------X
+// Description:      In-order walk restricted to the keys between lowValue and highValue.
+//                   Keys left of a node are smaller than it, so the left subtree is only entered when this
+//                   node lies above the lower bound; the right subtree only when it lies below the upper bound.
+// Parameters:       
+// Preconditions:    thisNode is not nullptr
+// Postconditions:   
+// Return value:     Number of nodeData sent to someSink
+// Functions called: traverseRange(), someSink()
+template <class typeT, class typeK, class typeO>
+template <class typeS>
+int BSTGeneric<typeT, typeK, typeO>::traverseRange(NodeGeneric<typeT>* thisNode, const string& lowValue, const string& highValue, bool highInclusive, bool highBounded, typeS& someSink) {
+   int matchCount = 0;
+   // Where does this node sit against each bound? (<0 below, 0 equal, >0 above)
+   int lowOrder = compareKeys(keyOf(thisNode->nodeData), lowValue);
+   int highOrder = -1;
+   if (highBounded) {
+      highOrder = compareKeys(keyOf(thisNode->nodeData), highValue);
+   }
+   // Is this node inside the bounds?
+   bool aboveLow = (lowOrder >= 0);
+   bool belowHigh = (highOrder < 0 || (highOrder == 0 && highInclusive));
+   // Left traverse, only if smaller keys can still reach the lower bound
+   if (thisNode->leftPtr != nullptr && lowOrder > 0) {
+      matchCount = matchCount + traverseRange(thisNode->leftPtr, lowValue, highValue, highInclusive, highBounded, someSink);
+   }
+   // Visit, skipping the deleted
+   if (aboveLow && belowHigh && thisNode->isDeleted == false) {
+      someSink(thisNode->nodeData);
+      matchCount++;
+   }
+   // Right traverse, only if larger keys can still reach the upper bound
+   if (thisNode->rightPtr != nullptr && highOrder < 0) {
+      matchCount = matchCount + traverseRange(thisNode->rightPtr, lowValue, highValue, highInclusive, highBounded, someSink);
+   }
+   return(matchCount);
+}
+
+// #traverseByRank(nodePtr, int&, int&, typeS&) - Recursive method
+// X--------------------------------------------------X
+// |    #traverseByRank(nodePtr, int&, int&, typeS&)    |
+// X--------------------------------------------------X
+// Description:      In-order walk over one page of undeleted nodes. A left subtree small enough to fall
+//                   entirely inside the skipped prefix is passed over by its subtreeSize without descent,
+//                   so reaching the page costs the tree height however deep the page is.
+// Parameters:       
+// Preconditions:    
+// Postconditions:   skipCount and takeCount are reduced by the nodes skipped and visited
+// Return value:     
+// Functions called: traverseByRank(), sizeOf(), someSink()
+template <class typeT, class typeK, class typeO>
+template <class typeS>
+void BSTGeneric<typeT, typeK, typeO>::traverseByRank(NodeGeneric<typeT>* thisNode, int& skipCount, int& takeCount, typeS& someSink) {
+   if (thisNode == nullptr || takeCount <= 0) {
+      return;
+   }
+   // Left traverse, or skip the left subtree whole if the page starts beyond it
+   int leftSize = sizeOf(thisNode->leftPtr);
+   if (skipCount >= leftSize) {
+      skipCount = skipCount - leftSize;
+   }
+   else {
+      traverseByRank(thisNode->leftPtr, skipCount, takeCount, someSink);
+   }
+   // Visit, counting only undeleted nodes
+   if (thisNode->isDeleted == false && takeCount > 0) {
+      if (skipCount > 0) {
+         skipCount--;
+      }
+      else {
+         someSink(thisNode->nodeData);
+         takeCount--;
+      }
+   }
+   // Right traverse
+   traverseByRank(thisNode->rightPtr, skipCount, takeCount, someSink);
+}
+
+// #adjustSizes(typeK&, int) - Helper method
+// X---------------------------------X
+// |    #adjustSizes(typeK&, int)    |
+// X---------------------------------X
+// Description:      Adds someDelta to subtreeSize along the search path to someKey. Called once a node's
+//                   undeleted status is known to change, so the common insert (a live keyword seen again)
+//                   pays for only one descent.
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: 
+template <class typeT, class typeK, class typeO>
+template <class typeL>
+void BSTGeneric<typeT, typeK, typeO>::adjustSizes(const typeL& someKey, int someDelta) {
+   NodeGeneric<typeT>* currNodePtr = rootPtr;
+   // Invariant: every node above currNodePtr on the path has been adjusted
+   while (currNodePtr != nullptr) {
+      currNodePtr->subtreeSize = currNodePtr->subtreeSize + someDelta;
+      int keyOrder = compareKeys(someKey, keyOf(currNodePtr->nodeData));
+      if (keyOrder == 0) {
+         return;
+      }
+      else if (keyOrder < 0) {
+         currNodePtr = currNodePtr->leftPtr;
+      }
+      else {
+         currNodePtr = currNodePtr->rightPtr;
+      }
+   }
+}
+
+// #setDeleteIf(nodePtr, typeP&) - Recursive method
+// X-------------------------------------X
+// |    #setDeleteIf(nodePtr, typeP&)    |
+// X-------------------------------------X
+// Description:      Post-order walk: tombstones the undeleted nodes someTest accepts, then recounts this
+//                   node's subtreeSize from its children, so one pass leaves every size correct
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     Number of undeleted nodes left in the subtree
+// Functions called: setDeleteIf(), someTest()
+template <class typeT, class typeK, class typeO>
+template <class typeP>
+int BSTGeneric<typeT, typeK, typeO>::setDeleteIf(NodeGeneric<typeT>* thisNode, typeP& someTest) {
+   if (thisNode == nullptr) {
+      return(0);
+   }
+   int liveCount = setDeleteIf(thisNode->leftPtr, someTest) + setDeleteIf(thisNode->rightPtr, someTest);
+   if (thisNode->isDeleted == false) {
+      if (someTest(thisNode->nodeData)) {
+         thisNode->isDeleted = true;
+         tombstoneCount++;
+      }
+      else {
+         liveCount++;
+      }
+   }
+   thisNode->subtreeSize = liveCount;
+   return(liveCount);
+}
+
+// #collectLive(nodePtr, vector) - Recursive method
+// X-------------------------------------X
+// |    #collectLive(nodePtr, vector)    |
+// X-------------------------------------X
+// Description:      In-order walk that frees tombstoned nodes and lists the undeleted ones in key order
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: collectLive()
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::collectLive(NodeGeneric<typeT>* thisNode, vector<NodeGeneric<typeT>*>& liveNodes) {
+   if (thisNode == nullptr) {
+      return;
+   }
+   // Read the right link before the node may be freed
+   NodeGeneric<typeT>* rightNodePtr = thisNode->rightPtr;
+   collectLive(thisNode->leftPtr, liveNodes);
+   if (thisNode->isDeleted == true) {
+      delete thisNode;
+   }
+   else {
+      liveNodes.push_back(thisNode);
+   }
+   collectLive(rightNodePtr, liveNodes);
+}
+
+// #linkBalanced(vector, int, int) - Recursive method
+// X---------------------------------------X
+// |    #linkBalanced(vector, int, int)    |
+// X---------------------------------------X
+// Description:      Links sortedNodes[lowIndex, highIndex) into a perfectly balanced subtree: the median
+//                   becomes the root and each half recursively becomes a child
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     Root of the subtree, or nullptr for an empty run
+// Functions called: linkBalanced()
+template <class typeT, class typeK, class typeO>
+typename BSTGeneric<typeT, typeK, typeO>::template NodeGeneric<typeT>* BSTGeneric<typeT, typeK, typeO>::linkBalanced(vector<NodeGeneric<typeT>*>& sortedNodes, int lowIndex, int highIndex) {
+   if (lowIndex >= highIndex) {
+      return(nullptr);
+   }
+   int middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+   NodeGeneric<typeT>* middleNodePtr = sortedNodes[middleIndex];
+   middleNodePtr->leftPtr = linkBalanced(sortedNodes, lowIndex, middleIndex);
+   middleNodePtr->rightPtr = linkBalanced(sortedNodes, middleIndex + 1, highIndex);
+   middleNodePtr->subtreeSize = highIndex - lowIndex;
+   return(middleNodePtr);
+}
+
+// X-----------------------------X
+// |    #linkSorted(vector)    |
+// X-----------------------------X
+// Description:      Makes sortedNodes the whole tree, perfectly balanced
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: linkBalanced()
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::linkSorted(vector<NodeGeneric<typeT>*>& sortedNodes) {
+   rootPtr = linkBalanced(sortedNodes, 0, sortedNodes.size());
+   nodeCount = sortedNodes.size();
+   tombstoneCount = 0;
+}
+
+// X----------------------------X
+// |    #sortByKey(vector)    |
+// X----------------------------X
+// Description:      Stable sort of node pointers by key, on several threads once the input is large
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: std::stable_sort(), std::inplace_merge(), std::thread
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::sortByKey(vector<NodeGeneric<typeT>*>& someNodes) {
+   // #KeyLess - Orders two nodes through this tree's key and comparison policies
+   struct KeyLess {
+      const BSTGeneric* treePtr;
+      bool operator()(const NodeGeneric<typeT>* someNode, const NodeGeneric<typeT>* otherNode) const {
+         return(treePtr->compareKeys(treePtr->keyOf(someNode->nodeData), treePtr->keyOf(otherNode->nodeData)) < 0);
+      }
+   };
+   KeyLess keyLess;
+   keyLess.treePtr = this;
+   // Sorted input, ie. a persisted keyword list, costs this one pass
+   bool isSorted = true;
+   for (size_t i = 1 ; i < someNodes.size() && isSorted ; i++) {
+      isSorted = !keyLess(someNodes[i], someNodes[i - 1]);
+   }
+   if (isSorted) {
+      return;
+   }
+   // #sliceCount - Number of slices sorted side by side: one per hardware thread, and one for small inputs
+   size_t sliceCount = thread::hardware_concurrency();
+   if (someNodes.size() < 65536 || sliceCount < 2) {
+      stable_sort(someNodes.begin(), someNodes.end(), keyLess);
+      return;
+   }
+   // #sliceStarts - Index of the first node of each slice, plus a final entry one past the end
+   vector<size_t> sliceStarts;
+   for (size_t i = 0 ; i <= sliceCount ; i++) {
+      sliceStarts.push_back(someNodes.size() * i / sliceCount);
+   }
+   typename vector<NodeGeneric<typeT>*>::iterator firstNode = someNodes.begin();
+   // Sort each slice on its own thread. The slices do not overlap, so no locking is needed.
+   vector<thread> workerThreads;
+   for (size_t i = 0 ; i < sliceCount ; i++) {
+      workerThreads.push_back(thread(stable_sort<typename vector<NodeGeneric<typeT>*>::iterator, KeyLess>,
+                                     firstNode + sliceStarts[i], firstNode + sliceStarts[i + 1], keyLess));
+   }
+   for (size_t i = 0 ; i < workerThreads.size() ; i++) {
+      workerThreads[i].join();
+   }
+   // Merge neighbouring sorted runs, doubling the run width each round. Merges within a round touch
+   // disjoint ranges, so they run in parallel too. The left run always comes first, keeping the sort stable.
+   for (size_t runWidth = 1 ; runWidth < sliceCount ; runWidth = runWidth * 2) {
+      workerThreads.clear();
+      for (size_t i = 0 ; i + runWidth < sliceCount ; i = i + 2 * runWidth) {
+         size_t endSlice = min(i + 2 * runWidth, sliceCount);
+         workerThreads.push_back(thread(inplace_merge<typename vector<NodeGeneric<typeT>*>::iterator, KeyLess>,
+                                        firstNode + sliceStarts[i], firstNode + sliceStarts[i + runWidth],
+                                        firstNode + sliceStarts[endSlice], keyLess));
+      }
+      for (size_t i = 0 ; i < workerThreads.size() ; i++) {
+         workerThreads[i].join();
+      }
+   }
+}
+
+// X---------------------------X
+// |    #compactIfSparse()    |
+// X---------------------------X
+// Description:      Compacts once tombstones exceed compactionPercent of the nodes. The O(n) rebuild then
+//                   happens at most once per n * compactionPercent / 100 deletions: O(1) amortized each.
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     true if a compaction ran
+// Functions called: compact()
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::compactIfSparse() {
+   if (tombstoneCount * 100 > nodeCount * compactionPercent) {
+      compact();
+      return(true);
+   }
+   return(false);
+}
+
+// X-------------------------X
+// |    #sizeOf(nodePtr)    |
+// X-------------------------X
+// Description:      Returns the subtreeSize of a node, treating nullptr as an empty subtree
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: 
+template <class typeT, class typeK, class typeO>
+int BSTGeneric<typeT, typeK, typeO>::sizeOf(NodeGeneric<typeT>* thisNodePtr) const {
+   if (thisNodePtr == nullptr) {
+      return(0);
+   }
+   return(thisNodePtr->subtreeSize);
+}
+
 // X-----------------------X
 // |    #visit(nodePtr)    |
 // X-----------------------X
@@ -410,8 +725,8 @@ bool BSTGeneric<typeT>::traversePostOrder(NodeGeneric<typeT>* thisNode) {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-void BSTGeneric<typeT>::visit(NodeGeneric<typeT>* thisNodePtr) const {
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::visit(NodeGeneric<typeT>* thisNodePtr) const {
    // Visit the node, but only perform an action if the node is undeleted
    if (thisNodePtr->isDeleted == false) {
       // Send the nodeData to the output stream
@@ -440,7 +755,7 @@ void BSTGeneric<typeT>::visit(NodeGeneric<typeT>* thisNodePtr) const {
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
 // X---------------------X
-// |    #find(string)    |
+// |    #find(typeL&)    |
 // X---------------------X
 // Finds a node with an equal value of the string argument
 // Parameters:       
@@ -448,8 +763,9 @@ void BSTGeneric<typeT>::visit(NodeGeneric<typeT>* thisNodePtr) const {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::find(string someValue) {
+template <class typeT, class typeK, class typeO>
+template <class typeL>
+bool BSTGeneric<typeT, typeK, typeO>::find(const typeL& someValue) {
    // If the tree is empty, do nothing
    if (rootPtr == nullptr) {
       cout << "No value found. This tree is empty." << endl;
@@ -460,18 +776,20 @@ bool BSTGeneric<typeT>::find(string someValue) {
       NodeGeneric<typeT>* currPtr = rootPtr;
       // While we haven't run off the end of the tree...
       while (currPtr != nullptr) {
+         // One three-way comparison decides every branch below
+         int keyOrder = compareKeys(someValue, keyOf(currPtr->nodeData));
          // Found it! (And it's undeleted)
-         if (currPtr->nodeData == someValue && currPtr->isDeleted == false) {
+         if (keyOrder == 0 && currPtr->isDeleted == false) {
             return(true);
          }
          // Found it! (But it's deleted)
-         else if (currPtr->nodeData == someValue && currPtr->isDeleted == true) {
+         else if (keyOrder == 0 && currPtr->isDeleted == true) {
             return(false);
          }
-         else if (someValue < currPtr->nodeData) {
+         else if (keyOrder < 0) {
             currPtr = currPtr->leftPtr;
          }
-         else if (someValue > currPtr->nodeData) {
+         else {
             currPtr = currPtr->rightPtr;
          }
       } // Closing while loop. We've either exited (found the value) or run off the tree
@@ -479,22 +797,22 @@ bool BSTGeneric<typeT>::find(string someValue) {
    }
 }
 
-// X------------------------X
-// |    #insert(<typeT>)    |
-// X------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::insert(typeT& someData) { // Receiving by reference
+// X----------------------------X
+// |    #insertNode(typeD&&)    |
+// X----------------------------X
+// Shared body of both insert()s. someData is forwarded once, into a new node or onto an existing
+// one, so an rvalue is moved and an lvalue is copied.
+template <class typeT, class typeK, class typeO>
+template <class typeD>
+bool BSTGeneric<typeT, typeK, typeO>::insertNode(typeD&& someData) {
    NodeGeneric<typeT>* currNodePtr = rootPtr;
    NodeGeneric<typeT>* prevNodePtr = nullptr;
+   // #keyOrder - Three-way comparison of someData against the current node (<0 less, 0 equal, >0 greater)
+   int keyOrder = 0;
    // Initial case: If tree is empty, insert a new node at the root
    if (rootPtr == nullptr) {
-      rootPtr = new NodeGeneric<typeT>(someData);
+      rootPtr = new NodeGeneric<typeT>(std::forward<typeD>(someData));
+      nodeCount++;
       // And halt execution
       return(true);
    }
@@ -503,23 +821,41 @@ bool BSTGeneric<typeT>::insert(typeT& someData) { // Receiving by reference
    // X-----------------------X
    // |    Node Comparison    |
    // X-----------------------X
+      keyOrder = compareKeys(keyOf(someData), keyOf(currNodePtr->nodeData));
 
       // X-------------X
       // |    Equal    |
       // X-------------X
-      if (currNodePtr->nodeData == someData) {
+      if (keyOrder == 0) {
          // Undelete if necessary
          if (currNodePtr->isDeleted == true) {
-            // Undelete it if so
-            currNodePtr->isDeleted = false;
+            // The tombstone's old contents were deleted, so revive it as a fresh node rather than merging into them
+            NodeGeneric<typeT>* freshNodePtr = new NodeGeneric<typeT>(std::forward<typeD>(someData));
+            freshNodePtr->leftPtr = currNodePtr->leftPtr;
+            freshNodePtr->rightPtr = currNodePtr->rightPtr;
+            freshNodePtr->subtreeSize = currNodePtr->subtreeSize;
+            if (prevNodePtr == nullptr) {
+               rootPtr = freshNodePtr;
+            }
+            else if (prevNodePtr->leftPtr == currNodePtr) {
+               prevNodePtr->leftPtr = freshNodePtr;
+            }
+            else {
+               prevNodePtr->rightPtr = freshNodePtr;
+            }
+            delete currNodePtr;
+            tombstoneCount--;
+            // And count it again along its path (someData may have been moved from, so key off the node)
+            adjustSizes(keyOf(freshNodePtr->nodeData), 1);
+            return(true);
          }
-         currNodePtr->nodeData = someData;
+         currNodePtr->nodeData = std::forward<typeD>(someData);
          return(false);
       }
       // X-----------------X
       // |    Less than    |
       // X-----------------X
-      else if (someData < currNodePtr->nodeData) {
+      else if (keyOrder < 0) {
          // Move left
          prevNodePtr = currNodePtr;
          currNodePtr = currNodePtr->leftPtr;
@@ -527,7 +863,7 @@ bool BSTGeneric<typeT>::insert(typeT& someData) { // Receiving by reference
       // X--------------------X
       // |    Greater than    |
       // X--------------------X
-      else if (someData > currNodePtr->nodeData) {
+      else {
          // Move right
          prevNodePtr = currNodePtr;
          currNodePtr = currNodePtr->rightPtr;
@@ -537,17 +873,111 @@ bool BSTGeneric<typeT>::insert(typeT& someData) { // Receiving by reference
    // X--------------------------X
    // |    Insertions off end    |
    // X--------------------------X
-   // If insert data is less than this node data, insert left
-   if (someData < prevNodePtr->nodeData) {
-      prevNodePtr->leftPtr = new NodeGeneric<typeT>(someData);
+   // Count the new node in every subtree on its path (walked before it is linked, so it keeps its own 1)
+   adjustSizes(keyOf(someData), 1);
+   nodeCount++;
+   // If insert data is less than this node data, insert left (the last comparison made was against Prev)
+   if (keyOrder < 0) {
+      prevNodePtr->leftPtr = new NodeGeneric<typeT>(std::forward<typeD>(someData));
    }
    // Otherwise, insert right
-   else if (someData > prevNodePtr->nodeData) {
-      prevNodePtr->rightPtr = new NodeGeneric<typeT>(someData);
+   else {
+      prevNodePtr->rightPtr = new NodeGeneric<typeT>(std::forward<typeD>(someData));
    }
    return(true);
 }
 
+// X------------------------X
+// |    #insert(<typeT>)    |
+// X------------------------X
+// Description:      Inserts a copy of someData, or assigns it onto the entry with the same key
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     true if a new node was linked
+// Functions called: insertNode()
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::insert(typeT& someData) { // Receiving by reference
+   return(insertNode(someData));
+}
+
+// X--------------------------X
+// |    #insert(<typeT>&&)    |
+// X--------------------------X
+// Description:      As insert(typeT&), but moves someData into the tree instead of copying it
+// Parameters:       someData - A temporary, ie. insert(theScribe.makeLinkedListContext())
+// Preconditions:    
+// Postconditions:   someData is moved from
+// Return value:     true if a new node was linked
+// Functions called: insertNode()
+template <class typeT, class typeK, class typeO>
+bool BSTGeneric<typeT, typeK, typeO>::insert(typeT&& someData) {
+   return(insertNode(std::move(someData)));
+}
+
+// X----------------------------------------------X
+// |    #traverseRange(string, string, typeS&)    |
+// X----------------------------------------------X
+// Description:      Streams every undeleted entry with lowValue <= key <= highValue to someSink, in order
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     Number of entries sent to someSink
+// Functions called: traverseRange(nodePtr, ...)
+template <class typeT, class typeK, class typeO>
+template <class typeS>
+int BSTGeneric<typeT, typeK, typeO>::traverseRange(const string& lowValue, const string& highValue, typeS& someSink) {
+   // Check for empty tree
+   if (rootPtr == nullptr) {
+      return(0);
+   }
+   return(traverseRange(rootPtr, lowValue, highValue, true, true, someSink));
+}
+
+// X---------------------------------------X
+// |    #traversePrefix(string, typeS&)    |
+// X---------------------------------------X
+// Description:      Streams every undeleted entry whose key starts with somePrefix to someSink, in order.
+//                   The keys sharing a prefix are exactly those in [prefix, successor), where the successor
+//                   is the prefix with its last incrementable character bumped by one ("inter" -> "intes").
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     Number of entries sent to someSink
+// Functions called: traverseRange(nodePtr, ...)
+template <class typeT, class typeK, class typeO>
+template <class typeS>
+int BSTGeneric<typeT, typeK, typeO>::traversePrefix(const string& somePrefix, typeS& someSink) {
+   // Check for empty tree
+   if (rootPtr == nullptr) {
+      return(0);
+   }
+   string successorValue = somePrefix;
+   // Trailing characters already at their maximum cannot be bumped, so drop them
+   while (!successorValue.empty() && (unsigned char)successorValue[successorValue.length() - 1] == 0xFF) {
+      successorValue.erase(successorValue.length() - 1);
+   }
+   // Nothing left to bump: every key at or above the prefix matches
+   if (successorValue.empty()) {
+      return(traverseRange(rootPtr, somePrefix, successorValue, false, false, someSink));
+   }
+   successorValue[successorValue.length() - 1]++;
+   return(traverseRange(rootPtr, somePrefix, successorValue, false, true, someSink));
+}
+
+// X---------------------------------------X
+// |    #traversePage(int, int, typeS&)    |
+// X---------------------------------------X
+// A count of -1 takes every entry from the offset on
+template <class typeT, class typeK, class typeO>
+template <class typeS>
+void BSTGeneric<typeT, typeK, typeO>::traversePage(int someOffset, int someCount, typeS& someSink) {
+   if (someCount < 0) {
+      someCount = sizeOf(rootPtr);
+   }
+   traverseByRank(rootPtr, someOffset, someCount, someSink);
+}
+
 // X-------------------X
 // |    #printout()    |
 // X-------------------X
@@ -557,8 +987,8 @@ bool BSTGeneric<typeT>::insert(typeT& someData) { // Receiving by reference
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-void BSTGeneric<typeT>::printout() {
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::printout() {
    // traversePreOrder();
    // cout << endl;
    traverseInOrder();
@@ -567,26 +997,380 @@ void BSTGeneric<typeT>::printout() {
    // cout << endl;
 }
 
-// #setDelete() -
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
+// X---------------------------X
+// |    #printout(int, int)    |
+// X---------------------------X
+// Method printing someCount entries of the in-order traversal, starting after the first someOffset
 // Parameters:       
 // Preconditions:    
 // Postconditions:   
 // Return value:     
-// Functions called: 
-template <class typeT>
-bool BSTGeneric<typeT>::setDelete(typeT someData) {
-   NodeGeneric<typeT>* targetNodePtr = this->retrieve(someData);
-   if (targetNodePtr != nullptr) {
-      targetNodePtr->isDeleted = true;
-      return(true);
+// Functions called: traverseByRank()
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::printout(int someOffset, int someCount) {
+   // #SinkVisit - Sends each entry of the page to cout, as visit() does
+   struct SinkVisit {
+      void operator()(typeT& someData) {
+         cout << someData;
+      }
+   } toConsole;
+   traverseByRank(rootPtr, someOffset, someCount, toConsole);
+   cout << endl;
+}
+
+// X------------------------------------------------------X
+// |    #printoutParallel(int, int, unsigned int, int)    |
+// X------------------------------------------------------X
+// As printout(int, int), with the entries rendered into per-chunk buffers on several threads and written in
+// rank order, either by this thread or by the rendering threads at offsets summed from the earlier chunks
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::printoutParallel(int someOffset, int someCount, unsigned int someThreads, int someDescriptor) {
+   // #firstRank - Rank of the first entry printed (a negative offset skips nothing, as in printout(int, int))
+   int firstRank = max(someOffset, 0);
+   // #entryTotal - Number of entries printed
+   int entryTotal = max(sizeOf(rootPtr) - firstRank, 0);
+   if (someCount >= 0 && someCount < entryTotal) {
+      entryTotal = someCount;
+   }
+   if (someThreads == 0) {
+      someThreads = 1;
+   }
+   // #chunkCount - Number of contiguous rank ranges rendered as a unit: sixteen per thread, so an uneven
+   //               spread of occurrences across the keywords still keeps every thread busy
+   size_t chunkCount = min((size_t)entryTotal, (size_t)someThreads * 16);
+   // #chunkStarts - Rank of the first entry of each chunk, plus a final entry one past the last
+   vector<int> chunkStarts;
+   for (size_t i = 0 ; i <= chunkCount ; i++) {
+      chunkStarts.push_back(firstRank + (int)((long long)entryTotal * i / max(chunkCount, (size_t)1)));
+   }
+   // #baseOffset - Offset of someDescriptor the output starts at, or -1 to write in order on this thread. A
+   //               descriptor opened to append ignores the offsets, so it is written in order too.
+   off_t baseOffset = -1;
+   if (someDescriptor >= 0 && chunkCount > 0) {
+      cout.flush();
+      int descriptorFlags = fcntl(someDescriptor, F_GETFL);
+      if (descriptorFlags != -1 && (descriptorFlags & O_APPEND) == 0) {
+         baseOffset = lseek(someDescriptor, 0, SEEK_CUR);
+      }
+   }
+   // #aheadLimit - Number of chunks that may be taken beyond the last one released (written, or placed)
+   size_t aheadLimit = (size_t)someThreads * 4;
+   // Shared state, guarded by chunkMutex
+   mutex chunkMutex;
+   condition_variable chunkSignal;
+   // #nextChunk - Index of the next chunk to render
+   size_t nextChunk = 0;
+   // #releasedCount - Number of chunks written (in order), or placed at an offset
+   size_t releasedCount = 0;
+   // #placedCount - Number of chunks, from the first, whose offsets are known
+   size_t placedCount = 0;
+   // #placedBytes - Total size of the placed chunks, which is the offset of the next
+   off_t placedBytes = 0;
+   // #chunkBuffers - Rendering of each chunk, held until written when writing in order
+   vector<string> chunkBuffers(chunkCount);
+   // #isRendered - Whether each chunk's buffer is ready to be written in order
+   vector<char> isRendered(chunkCount, 0);
+   // #isWriteFailed - Whether a pwrite() failed, leaving the output short
+   atomic<bool> isWriteFailed(false);
+
+   // #SinkStream - Sends each entry of a chunk to its buffer, as visit() sends it to cout
+   struct SinkStream {
+      ostringstream* streamPtr;
+      void operator()(typeT& someData) {
+         *streamPtr << someData;
+      }
+   };
+   auto renderChunks = [&]() {
+      while (true) {
+         size_t thisChunk = 0;
+         {
+            unique_lock<mutex> chunkLock(chunkMutex);
+            chunkSignal.wait(chunkLock, [&]() { return(nextChunk >= chunkCount || nextChunk < releasedCount + aheadLimit); });
+            if (nextChunk >= chunkCount) {
+               return;
+            }
+            thisChunk = nextChunk++;
+         }
+         ostringstream chunkStream;
+         SinkStream toStream = { &chunkStream };
+         int skipCount = chunkStarts[thisChunk];
+         int takeCount = chunkStarts[thisChunk + 1] - chunkStarts[thisChunk];
+         traverseByRank(rootPtr, skipCount, takeCount, toStream);
+         string chunkText = chunkStream.str();
+         if (baseOffset < 0) {
+            unique_lock<mutex> chunkLock(chunkMutex);
+            chunkBuffers[thisChunk].swap(chunkText);
+            isRendered[thisChunk] = 1;
+            chunkSignal.notify_all();
+            continue;
+         }
+         // The chunk's offset is known once every chunk before it has its size; the lowest chunk still
+         // rendering never waits, so the chain always advances
+         off_t chunkOffset = 0;
+         {
+            unique_lock<mutex> chunkLock(chunkMutex);
+            chunkSignal.wait(chunkLock, [&]() { return(placedCount == thisChunk); });
+            chunkOffset = baseOffset + placedBytes;
+            placedBytes = placedBytes + (off_t)chunkText.size();
+            placedCount++;
+            releasedCount++;
+            chunkSignal.notify_all();
+         }
+         size_t writtenBytes = 0;
+         while (writtenBytes < chunkText.size()) {
+            ssize_t writeResult = pwrite(someDescriptor, chunkText.data() + writtenBytes, chunkText.size() - writtenBytes, chunkOffset + writtenBytes);
+            if (writeResult <= 0) {
+               isWriteFailed = true;
+               break;
+            }
+            writtenBytes = writtenBytes + writeResult;
+         }
+      }
+   };
+   vector<thread> renderThreads;
+   for (unsigned int i = 0 ; i < someThreads && chunkCount > 0 ; i++) {
+      renderThreads.push_back(thread(renderChunks));
+   }
+   // Writing in order: each chunk is written as soon as it and every chunk before it are rendered
+   if (baseOffset < 0) {
+      for (size_t i = 0 ; i < chunkCount ; i++) {
+         string chunkText;
+         {
+            unique_lock<mutex> chunkLock(chunkMutex);
+            chunkSignal.wait(chunkLock, [&]() { return(isRendered[i] != 0); });
+            chunkBuffers[i].swap(chunkText);
+            releasedCount++;
+            chunkSignal.notify_all();
+         }
+         cout.write(chunkText.data(), chunkText.size());
+      }
+   }
+   for (unsigned int i = 0 ; i < renderThreads.size() ; i++) {
+      renderThreads[i].join();
+   }
+   // The descriptor continues from the end of the chunks, where cout resumes
+   if (baseOffset >= 0) {
+      lseek(someDescriptor, baseOffset + placedBytes, SEEK_SET);
+      if (isWriteFailed) {
+         cout << "Unable to write the concordance at its offsets. Output is incomplete." << endl;
+      }
+   }
+   cout << endl;
+}
+
+// X-----------------------------X
+// |    #select(int, typeS&)    |
+// X-----------------------------X
+// Description:      Hands the entry of in-order rank someRank to someSink. At each node the left
+//                   subtreeSize says whether the rank lies left, here, or right (rebased past this node).
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     true if the rank exists
+// Functions called: sizeOf(), someSink()
+template <class typeT, class typeK, class typeO>
+template <class typeS>
+bool BSTGeneric<typeT, typeK, typeO>::select(int someRank, typeS& someSink) {
+   if (someRank < 0 || someRank >= sizeOf(rootPtr)) {
+      return(false);
+   }
+   NodeGeneric<typeT>* currNodePtr = rootPtr;
+   // Invariant: the wanted entry is the someRank-th undeleted node of the subtree at currNodePtr
+   while (currNodePtr != nullptr) {
+      int leftSize = sizeOf(currNodePtr->leftPtr);
+      if (someRank < leftSize) {
+         currNodePtr = currNodePtr->leftPtr;
+      }
+      else if (someRank == leftSize && currNodePtr->isDeleted == false) {
+         someSink(currNodePtr->nodeData);
+         return(true);
+      }
+      else {
+         someRank = someRank - leftSize;
+         if (currNodePtr->isDeleted == false) {
+            someRank--;
+         }
+         currNodePtr = currNodePtr->rightPtr;
+      }
+   }
+   return(false);
+}
+
+// X---------------------X
+// |    #rank(typeL&)    |
+// X---------------------X
+// Description:      Counts the undeleted entries whose key is less than someValue. Every step right
+//                   passes over the left subtree and the node itself.
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     0 to getSize()
+// Functions called: sizeOf()
+template <class typeT, class typeK, class typeO>
+template <class typeL>
+int BSTGeneric<typeT, typeK, typeO>::rank(const typeL& someValue) {
+   int retRank = 0;
+   NodeGeneric<typeT>* currNodePtr = rootPtr;
+   while (currNodePtr != nullptr) {
+      if (compareKeys(keyOf(currNodePtr->nodeData), someValue) < 0) {
+         retRank = retRank + sizeOf(currNodePtr->leftPtr);
+         if (currNodePtr->isDeleted == false) {
+            retRank++;
+         }
+         currNodePtr = currNodePtr->rightPtr;
+      }
+      else {
+         currNodePtr = currNodePtr->leftPtr;
+      }
+   }
+   return(retRank);
+}
+
+// #setDelete() -
+// X--------------------------X
+// |    #setDelete(typeL&)    |
+// X--------------------------X
+// Description:      Tombstones the undeleted entry with key someValue, then compacts if tombstones have
+//                   grown past compactionPercent of the tree
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     true if an entry was deleted
+// Functions called: adjustSizes(), compactIfSparse()
+template <class typeT, class typeK, class typeO>
+template <class typeL>
+bool BSTGeneric<typeT, typeK, typeO>::setDelete(const typeL& someValue) {
+   NodeGeneric<typeT>* currNodePtr = rootPtr;
+   while (currNodePtr != nullptr) {
+      int keyOrder = compareKeys(someValue, keyOf(currNodePtr->nodeData));
+      if (keyOrder == 0) {
+         // Already deleted: nothing to do
+         if (currNodePtr->isDeleted == true) {
+            return(false);
+         }
+         currNodePtr->isDeleted = true;
+         tombstoneCount++;
+         // Stop counting it along its path
+         adjustSizes(someValue, -1);
+         compactIfSparse();
+         return(true);
+      }
+      else if (keyOrder < 0) {
+         currNodePtr = currNodePtr->leftPtr;
+      }
+      else {
+         currNodePtr = currNodePtr->rightPtr;
+      }
    }
    return(false);
 }
 
+// X-----------------------------X
+// |    #setDeleteIf(typeP&)    |
+// X-----------------------------X
+// Description:      Tombstones every undeleted entry someTest accepts, in one O(n) pass, then compacts if
+//                   tombstones have grown past compactionPercent of the tree
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     Number of entries deleted
+// Functions called: setDeleteIf(nodePtr, ...), compactIfSparse()
+template <class typeT, class typeK, class typeO>
+template <class typeP>
+int BSTGeneric<typeT, typeK, typeO>::setDeleteIf(typeP& someTest) {
+   int sizeBefore = sizeOf(rootPtr);
+   int sizeAfter = setDeleteIf(rootPtr, someTest);
+   compactIfSparse();
+   return(sizeBefore - sizeAfter);
+}
+
+// X------------------------------------X
+// |    #setDeleteIf(typeL&, typeP&)    |
+// X------------------------------------X
+// Description:      Finds the undeleted entry with key someValue and tombstones it if someTest accepts it
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     true if the entry was deleted
+// Functions called: setDelete()
+template <class typeT, class typeK, class typeO>
+template <class typeL, class typeP>
+bool BSTGeneric<typeT, typeK, typeO>::setDeleteIf(const typeL& someValue, typeP& someTest) {
+   NodeGeneric<typeT>* currNodePtr = rootPtr;
+   while (currNodePtr != nullptr) {
+      int keyOrder = compareKeys(someValue, keyOf(currNodePtr->nodeData));
+      if (keyOrder == 0) {
+         if (currNodePtr->isDeleted == true || !someTest(currNodePtr->nodeData)) {
+            return(false);
+         }
+         // The sizes along the path and the compaction check are setDelete()'s
+         return(setDelete(someValue));
+      }
+      else if (keyOrder < 0) {
+         currNodePtr = currNodePtr->leftPtr;
+      }
+      else {
+         currNodePtr = currNodePtr->rightPtr;
+      }
+   }
+   return(false);
+}
+
+// X-------------------X
+// |    #compact()    |
+// X-------------------X
+// Description:      Frees every tombstone and relinks the undeleted nodes into a perfectly balanced tree
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: collectLive(), linkBalanced()
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::compact() {
+   vector<NodeGeneric<typeT>*> liveNodes;
+   liveNodes.reserve(nodeCount - tombstoneCount);
+   collectLive(rootPtr, liveNodes);
+   linkSorted(liveNodes);
+}
+
+// X--------------------------------X
+// |    #bulkLoad(typeI, typeI)    |
+// X--------------------------------X
+// Description:      Replaces the tree's contents with a range of entries, in a perfectly balanced tree
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     getSize()
+// Functions called: obliviate(), sortByKey(), linkSorted()
+template <class typeT, class typeK, class typeO>
+template <class typeI>
+int BSTGeneric<typeT, typeK, typeO>::bulkLoad(typeI firstData, typeI lastData) {
+   // One node per entry, built straight from the range (moved from it, with a move iterator)
+   vector<NodeGeneric<typeT>*> sortedNodes;
+   for ( ; firstData != lastData ; ++firstData) {
+      sortedNodes.push_back(new NodeGeneric<typeT>(*firstData));
+   }
+   // Only the node pointers are sorted, so no entry is moved or assigned while sorting
+   sortByKey(sortedNodes);
+   // Fold each run of equal keys into its first node, in range order, as repeated insert()s would
+   size_t keptCount = 0;
+   for (size_t i = 0 ; i < sortedNodes.size() ; i++) {
+      if (keptCount > 0 && compareKeys(keyOf(sortedNodes[keptCount - 1]->nodeData), keyOf(sortedNodes[i]->nodeData)) == 0) {
+         sortedNodes[keptCount - 1]->nodeData = std::move(sortedNodes[i]->nodeData);
+         delete sortedNodes[i];
+      }
+      else {
+         sortedNodes[keptCount] = sortedNodes[i];
+         keptCount++;
+      }
+   }
+   sortedNodes.resize(keptCount);
+   // Replace the old tree
+   obliviate();
+   linkSorted(sortedNodes);
+   return(nodeCount);
+}
+
 
 
 //-------|---------|---------|---------|---------|---------|---------|---------|
@@ -604,10 +1388,13 @@ bool BSTGeneric<typeT>::setDelete(typeT someData) {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-BSTGeneric<typeT>::BSTGeneric() {
+template <class typeT, class typeK, class typeO>
+BSTGeneric<typeT, typeK, typeO>::BSTGeneric() {
    treeData = "NameGoesHere";
    this->rootPtr = nullptr;
+   nodeCount = 0;
+   tombstoneCount = 0;
+   compactionPercent = 25;
 }
 
 // X---------------------------X
@@ -619,12 +1406,17 @@ BSTGeneric<typeT>::BSTGeneric() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-BSTGeneric<typeT>::BSTGeneric(string fileAddress) {
+template <class typeT, class typeK, class typeO>
+BSTGeneric<typeT, typeK, typeO>::BSTGeneric(string fileAddress) {
    treeData = "NameGoesHere";
    rootPtr = nullptr;
+   nodeCount = 0;
+   tombstoneCount = 0;
+   compactionPercent = 25;
    // String for storing a single word
    string aWord;
+   // Every word of the file, in file order
+   vector<typeT> fileWords;
    // Generate the Input File Stream (ifstream) object
    ifstream fileInputObj;
    fileInputObj.open(fileAddress);
@@ -634,10 +1426,32 @@ BSTGeneric<typeT>::BSTGeneric(string fileAddress) {
    }
    // Read the file
    while (fileInputObj >> aWord) {
-      this->insert(aWord);
+      fileWords.push_back(aWord);
    }
    // After reading from the file, close the stream
    fileInputObj.close();
+   // And build the tree from the words in one pass, balanced whatever order the file is in
+   bulkLoad(make_move_iterator(fileWords.begin()), make_move_iterator(fileWords.end()));
+}
+
+// X--------------------------------X
+// |    #BSTGeneric(typeI, typeI)    |
+// X--------------------------------X
+// Constructor of the BSTGeneric class from a range of entries
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: bulkLoad()
+template <class typeT, class typeK, class typeO>
+template <class typeI>
+BSTGeneric<typeT, typeK, typeO>::BSTGeneric(typeI firstData, typeI lastData) {
+   treeData = "NameGoesHere";
+   rootPtr = nullptr;
+   nodeCount = 0;
+   tombstoneCount = 0;
+   compactionPercent = 25;
+   bulkLoad(firstData, lastData);
 }
 
 // X----------------------X
@@ -649,8 +1463,8 @@ BSTGeneric<typeT>::BSTGeneric(string fileAddress) {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-BSTGeneric<typeT>::~BSTGeneric() {
+template <class typeT, class typeK, class typeO>
+BSTGeneric<typeT, typeK, typeO>::~BSTGeneric() {
    this->obliviate();
 }
 
@@ -670,8 +1484,8 @@ BSTGeneric<typeT>::~BSTGeneric() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-typeT& BSTGeneric<typeT>::getRootValue() {
+template <class typeT, class typeK, class typeO>
+typeT& BSTGeneric<typeT, typeK, typeO>::getRootValue() {
    return rootPtr->nodeData;
 }
 
@@ -684,11 +1498,39 @@ typeT& BSTGeneric<typeT>::getRootValue() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-string BSTGeneric<typeT>::getValue() {
+template <class typeT, class typeK, class typeO>
+string BSTGeneric<typeT, typeK, typeO>::getValue() {
    return treeData;
 }
 
+// X------------------X
+// |    #getSize()    |
+// X------------------X
+// Returns the number of undeleted entries in the tree
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     >= 0
+// Functions called: sizeOf()
+template <class typeT, class typeK, class typeO>
+int BSTGeneric<typeT, typeK, typeO>::getSize() {
+   return(sizeOf(rootPtr));
+}
+
+// X-----------------------X
+// |    #getNodeBytes()    |
+// X-----------------------X
+// Returns the bytes allocated for the tree's nodes, tombstones included, excluding heap storage owned by the entries
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     >= 0
+// Functions called: 
+template <class typeT, class typeK, class typeO>
+size_t BSTGeneric<typeT, typeK, typeO>::getNodeBytes() {
+   return(nodeCount * sizeof(NodeGeneric<typeT>));
+}
+
 // X-------------------X
 // |    #setValue()    |
 // X-------------------X
@@ -698,7 +1540,7 @@ string BSTGeneric<typeT>::getValue() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-template <class typeT>
-void BSTGeneric<typeT>::setValue( string someValue ) {
+template <class typeT, class typeK, class typeO>
+void BSTGeneric<typeT, typeK, typeO>::setValue( string someValue ) {
    treeData = someValue;
 }
@@ -165,16 +165,75 @@
 // Necessary for file stream operations
 #include <fstream>
 
+// Necessary for vector operations (node lists during compaction)
+#include <vector>
+
+// Necessary for std::move and std::forward (insertion by rvalue)
+#include <utility>
+
+// Necessary for sorting and merging runs of nodes (bulk loading)
+#include <algorithm>
+
+// Necessary for std::make_move_iterator (bulk loading the stoplist)
+#include <iterator>
+
+// Necessary for thread operations (sorting large bulk loads in parallel, and rendering in parallel)
+#include <thread>
+
+// Necessary for handing rendered chunks between threads in order (printoutParallel())
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+// Necessary for rendering a chunk of entries into its own buffer (printoutParallel())
+#include <sstream>
+
+// Necessary for pwrite() and lseek() (printoutParallel() writing at offsets)
+#include <unistd.h>
+
+// Necessary for fcntl() (printoutParallel() refusing offsets on a descriptor opened to append)
+#include <fcntl.h>
+
 // Node definition for a generic node (holding data, left, and right)
 // #include "NodeGeneric.cpp"
 
 using namespace std;
 
+// X--------------------X
+// |    #KeyIdentity    |
+// X--------------------X
+// Description: Default key policy. The stored data is its own key, ie. BSTGeneric<string>
+struct KeyIdentity {
+   template <class typeD>
+   const typeD& operator()(const typeD& someData) const {
+      return(someData);
+   }
+};
+
+// X------------------------X
+// |    #CompareThreeWay    |
+// X------------------------X
+// Description: Default comparison policy. Orders two keys with one call: <0 less, 0 equal, >0 greater.
+//              The const char* overloads let a literal be looked up without building a string.
+struct CompareThreeWay {
+   int operator()(const string& someKey, const string& otherKey) const {
+      return(someKey.compare(otherKey));
+   }
+   int operator()(const string& someKey, const char* otherKey) const {
+      return(someKey.compare(otherKey));
+   }
+   int operator()(const char* someKey, const string& otherKey) const {
+      return(-otherKey.compare(someKey));
+   }
+};
+
 // X---------------------X
 // |    #BSTGeneric      |
 // X---------------------X
 // Description: Generic Binary Search Tree (BST)
-template <class typeT>
+//              typeK - Key policy: callable mapping a const typeT& to the key the tree is ordered by
+//              typeO - Comparison policy: callable returning <0, 0 or >0 for two keys (or a key and a lookup value)
+template <class typeT, class typeK = KeyIdentity, class typeO = CompareThreeWay>
 class BSTGeneric {
 
 protected:
@@ -183,12 +242,15 @@ protected:
    struct NodeGeneric {
       typeC nodeData; // LLC default constructor called
       bool isDeleted;
+      // #subtreeSize - Number of undeleted nodes in the subtree rooted here, this node included
+      int subtreeSize;
       NodeGeneric<typeC>* leftPtr;
       NodeGeneric<typeC>* rightPtr;
 
       NodeGeneric() {
          nodeData = NULL;
          isDeleted = 1;
+         subtreeSize = 0;
          leftPtr = nullptr;
          rightPtr = nullptr;
       }
@@ -197,6 +259,15 @@ protected:
       NodeGeneric(typeC& someData) {
          nodeData = someData; // LLC assignment operator called here, LHarg = default ("."), RHarg = received ("the"
          isDeleted = 0;
+         subtreeSize = 1;
+         leftPtr = nullptr;
+         rightPtr = nullptr;
+      }
+
+      // #NodeGeneric(<T>&&) - Node constructor that move-constructs nodeData, with no default construction or assignment
+      NodeGeneric(typeC&& someData) : nodeData(std::move(someData)) {
+         isDeleted = 0;
+         subtreeSize = 1;
          leftPtr = nullptr;
          rightPtr = nullptr;
       }
@@ -223,6 +294,41 @@ string treeData;
 // Invariant information: 
 NodeGeneric<typeT>* rootPtr;
 
+// X------------------X
+// |    #nodeCount    |
+// X------------------X
+// Number of nodes allocated in this tree, deleted or not.
+// Invariant information: nodeCount == getSize() + tombstoneCount
+int nodeCount;
+
+// X-----------------------X
+// |    #tombstoneCount    |
+// X-----------------------X
+// Number of nodes marked isDeleted but still linked into the tree.
+// Invariant information: 0 <= tombstoneCount <= nodeCount
+int tombstoneCount;
+
+// X--------------------------X
+// |    #compactionPercent    |
+// X--------------------------X
+// Share of tombstoned nodes, as a percentage of nodeCount, above which the tree is compacted.
+// Invariant information: 1 to 100
+int compactionPercent;
+
+// X--------------X
+// |    #keyOf    |
+// X--------------X
+// Key policy instance, applied to nodeData before every comparison.
+// Invariant information: 
+typeK keyOf;
+
+// X--------------------X
+// |    #compareKeys    |
+// X--------------------X
+// Comparison policy instance. Called once per node visited during a descent.
+// Invariant information: 
+typeO compareKeys;
+
 
 //-------|---------|---------|---------|---------|---------|---------|---------|
 //
@@ -294,6 +400,155 @@ bool traverseInOrder(NodeGeneric<typeT>* nodePtr);
 bool traversePostOrder();
 bool traversePostOrder(NodeGeneric<typeT>* nodePtr);
 
+// #traverseRange(nodePtr, string, string, bool, bool, typeS&) - Recursive method
+// X-------------------------------------------------------------------X
+// |    #traverseRange(nodePtr, string, string, bool, bool, typeS&)    |
+// X-------------------------------------------------------------------X
+// Description:      In-order walk restricted to the keys in [lowValue, highValue]. A subtree is entered
+//                   only when its side of this node can still hold keys inside the bounds.
+// Parameters:       nodePtr - Root of the subtree to search
+//                   lowValue - Inclusive lower bound
+//                   highValue - Upper bound, ignored when highBounded is false
+//                   highInclusive - Whether a key equal to highValue matches
+//                   highBounded - Whether highValue applies at all
+//                   someSink - Callable receiving each matching, undeleted nodeData in order
+// Preconditions:    nodePtr is not nullptr
+// Postconditions:   None
+// Return value:     Number of nodeData sent to someSink
+// Functions called: traverseRange(), someSink()
+template <class typeS>
+int traverseRange(NodeGeneric<typeT>* nodePtr, const string& lowValue, const string& highValue, bool highInclusive, bool highBounded, typeS& someSink);
+
+// #traverseByRank(nodePtr, int&, int&, typeS&) - Recursive method
+// X--------------------------------------------------X
+// |    #traverseByRank(nodePtr, int&, int&, typeS&)    |
+// X--------------------------------------------------X
+// Description:      In-order walk that skips whole subtrees by their subtreeSize until skipCount undeleted
+//                   nodes have been passed over, then hands the next takeCount to someSink
+// Parameters:       nodePtr - Root of the subtree, may be nullptr
+//                   skipCount - Undeleted nodes still to skip, decremented as they are passed
+//                   takeCount - Undeleted nodes still to visit, decremented as they are visited
+//                   someSink - Callable receiving each visited nodeData
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     None
+// Functions called: traverseByRank(), sizeOf(), someSink()
+template <class typeS>
+void traverseByRank(NodeGeneric<typeT>* nodePtr, int& skipCount, int& takeCount, typeS& someSink);
+
+// #adjustSizes(typeL&, int) - Helper method
+// X---------------------------------X
+// |    #adjustSizes(typeL&, int)    |
+// X---------------------------------X
+// Description:      Adds someDelta to the subtreeSize of every node on the search path to someKey
+// Parameters:       someKey - Key whose node just became undeleted (+1) or deleted (-1)
+//                   someDelta - Change in the number of undeleted nodes
+// Preconditions:    None
+// Postconditions:   Every subtreeSize on the path reflects the change
+// Return value:     None
+// Functions called: None
+template <class typeL>
+void adjustSizes(const typeL& someKey, int someDelta);
+
+// #insertNode(typeD&&) - Helper method
+// X----------------------------X
+// |    #insertNode(typeD&&)    |
+// X----------------------------X
+// Description:      Descends to someData's key, then links a new node or assigns onto the existing entry.
+//                   A tombstoned entry is replaced by a fresh node rather than assigned onto.
+// Parameters:       someData - typeT lvalue (copied) or rvalue (moved), forwarded exactly once
+// Preconditions:    None
+// Postconditions:   The key is present and undeleted
+// Return value:     true if a new node was linked, including one replacing a tombstone; false if the
+//                   data was assigned onto a live entry
+// Functions called: adjustSizes(), std::forward()
+template <class typeD>
+bool insertNode(typeD&& someData);
+
+// #setDeleteIf(nodePtr, typeP&) - Recursive method
+// X-------------------------------------X
+// |    #setDeleteIf(nodePtr, typeP&)    |
+// X-------------------------------------X
+// Description:      Post-order walk that tombstones every undeleted node someTest accepts and recounts
+//                   subtreeSize on the way back up
+// Parameters:       nodePtr - Root of the subtree, may be nullptr
+//                   someTest - Callable taking a typeT&, returning true to delete it
+// Preconditions:    None
+// Postconditions:   subtreeSize is correct throughout the subtree
+// Return value:     Number of undeleted nodes left in the subtree
+// Functions called: setDeleteIf(), someTest()
+template <class typeP>
+int setDeleteIf(NodeGeneric<typeT>* nodePtr, typeP& someTest);
+
+// #collectLive(nodePtr, vector) - Recursive method
+// X-------------------------------------X
+// |    #collectLive(nodePtr, vector)    |
+// X-------------------------------------X
+// Description:      In-order walk that frees every tombstoned node and lists the undeleted ones in order
+// Parameters:       nodePtr - Root of the subtree, may be nullptr
+//                   liveNodes - Receives the undeleted nodes, in key order
+// Preconditions:    None
+// Postconditions:   The subtree's links are no longer meaningful; only liveNodes holds its nodes
+// Return value:     None
+// Functions called: collectLive()
+void collectLive(NodeGeneric<typeT>* nodePtr, vector<NodeGeneric<typeT>*>& liveNodes);
+
+// #linkBalanced(vector, int, int) - Recursive method
+// X---------------------------------------X
+// |    #linkBalanced(vector, int, int)    |
+// X---------------------------------------X
+// Description:      Links a sorted run of nodes into a perfectly balanced subtree, median at the root
+// Parameters:       sortedNodes - Nodes in key order
+//                   lowIndex - First index of the run
+//                   highIndex - One past the last index of the run
+// Preconditions:    Every node in the run is undeleted
+// Postconditions:   Links and subtreeSize of every node in the run are rewritten
+// Return value:     Root of the subtree, or nullptr for an empty run
+// Functions called: linkBalanced()
+NodeGeneric<typeT>* linkBalanced(vector<NodeGeneric<typeT>*>& sortedNodes, int lowIndex, int highIndex);
+
+// #linkSorted(vector) - Helper method
+// X---------------------------X
+// |    #linkSorted(vector)    |
+// X---------------------------X
+// Description:      Makes a sorted list of nodes the whole tree. The one relinking step shared by bulkLoad()
+//                   and compact(): O(n), with no per-key descent.
+// Parameters:       sortedNodes - Undeleted nodes with distinct keys, in key order
+// Preconditions:    The previous tree's nodes are all freed or in sortedNodes
+// Postconditions:   Tree is perfectly balanced. nodeCount == sortedNodes.size(), tombstoneCount == 0.
+// Return value:     None
+// Functions called: linkBalanced()
+void linkSorted(vector<NodeGeneric<typeT>*>& sortedNodes);
+
+// #sortByKey(vector) - Helper method
+// X--------------------------X
+// |    #sortByKey(vector)    |
+// X--------------------------X
+// Description:      Stable sort of nodes by key. Already-sorted input is detected in one pass and left alone.
+//                   Large inputs are cut into one slice per hardware thread, each slice sorted on its own
+//                   thread, and the slices merged pairwise, each round of merges also running in parallel.
+// Parameters:       someNodes - Nodes to sort. Only the pointers move.
+// Preconditions:    None
+// Postconditions:   someNodes is in key order. Nodes with equal keys keep their relative order.
+// Return value:     None
+// Functions called: std::stable_sort(), std::inplace_merge(), std::thread
+void sortByKey(vector<NodeGeneric<typeT>*>& someNodes);
+
+// X--------------------------X
+// |    #compactIfSparse()    |
+// X--------------------------X
+// Description:      Compacts the tree once tombstones exceed compactionPercent of the nodes
+// Return value:     true if a compaction ran
+// Functions called: compact()
+bool compactIfSparse();
+
+// X-------------------------X
+// |    #sizeOf(nodePtr)    |
+// X-------------------------X
+// Description:      Returns the subtreeSize of a node, treating nullptr as an empty subtree
+// Return value:     >= 0
+int sizeOf(NodeGeneric<typeT>* nodePtr) const;
+
 // X-----------------------------------X
 // |    #NAME    |
 // X-----------------------------------X
@@ -325,15 +580,17 @@ public:
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
 // X---------------------X
-// |    #find(string)    |
+// |    #find(typeL&)    |
 // X---------------------X
-// Finds a node with an equal value of the string argument
-// Parameters:       
+// Finds a node whose key compares equal to the argument
+// Parameters:       someValue - Any value compareKeys accepts against a key, ie. a string or a literal.
+//                               No typeT is built for the lookup.
 // Preconditions:    
 // Postconditions:   
 // Return value:     
 // Functions called: 
-bool find(string someValue);
+template <class typeL>
+bool find(const typeL& someValue);
 
 // X------------------------X
 // |    #insert(<typeT>)    |
@@ -346,6 +603,61 @@ bool find(string someValue);
 // Functions called: 
 bool insert(typeT& someData); // Gets passed a LLC by reference
 
+// X--------------------------X
+// |    #insert(<typeT>&&)    |
+// X--------------------------X
+// Description:      As insert(typeT&), but moves someData into the tree. A new key costs the node
+//                   allocation alone; an existing key has someData move-assigned onto its entry.
+// Parameters:       someData - A temporary, ie. insert(theScribe.makeLinkedListContext())
+// Preconditions:    
+// Postconditions:   someData is moved from
+// Return value:     true if a new node was linked
+// Functions called: insertNode()
+bool insert(typeT&& someData);
+
+// X----------------------------------------------X
+// |    #traverseRange(string, string, typeS&)    |
+// X----------------------------------------------X
+// Description:      Streams every undeleted entry whose key lies between two bounds, in order.
+//                   Only the subtrees that can hold such keys are descended: O(height + matches).
+// Parameters:       lowValue - Inclusive lower bound, ie. "m"
+//                   highValue - Inclusive upper bound, ie. "n"
+//                   someSink - Callable taking a typeT&, invoked once per match
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     Number of entries sent to someSink
+// Functions called: traverseRange(nodePtr, ...)
+template <class typeS>
+int traverseRange(const string& lowValue, const string& highValue, typeS& someSink);
+
+// X---------------------------------------X
+// |    #traversePrefix(string, typeS&)    |
+// X---------------------------------------X
+// Description:      Streams every undeleted entry whose key starts with a prefix, in order.
+//                   Runs as a range walk over [prefix, successor of prefix).
+// Parameters:       somePrefix - Leading characters to match, ie. "inter"
+//                   someSink - Callable taking a typeT&, invoked once per match
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     Number of entries sent to someSink
+// Functions called: traverseRange(nodePtr, ...)
+template <class typeS>
+int traversePrefix(const string& somePrefix, typeS& someSink);
+
+// X---------------------------------------X
+// |    #traversePage(int, int, typeS&)    |
+// X---------------------------------------X
+// Description:      Streams one page of the undeleted entries, in order, as printout(int, int) prints it
+// Parameters:       someOffset - Number of undeleted entries to skip
+//                   someCount - Number of undeleted entries to send, or -1 for all after someOffset
+//                   someSink - Callable taking a typeT&
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     None
+// Functions called: traverseByRank(nodePtr, ...), sizeOf()
+template <class typeS>
+void traversePage(int someOffset, int someCount, typeS& someSink);
+
 // X-------------------X
 // |    #printout()    |
 // X-------------------X
@@ -357,17 +669,134 @@ bool insert(typeT& someData); // Gets passed a LLC by reference
 // Functions called: 
 void printout();
 
+// X---------------------------X
+// |    #printout(int, int)    |
+// X---------------------------X
+// Method printing one page of the in-order traversal, ie. printout(49900, 100) for page 500
+// Parameters:       someOffset - Number of undeleted entries to skip
+//                   someCount - Number of undeleted entries to print
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: traverseByRank()
+void printout(int someOffset, int someCount);
+
+// X------------------------------------------------------X
+// |    #printoutParallel(int, int, unsigned int, int)    |
+// X------------------------------------------------------X
+// Description:      As printout(int, int), rendering on several threads. The ranks are cut into contiguous
+//                   chunks, sixteen per thread; each thread takes the next chunk, finds its first entry by
+//                   subtree sizes and renders the chunk into its own buffer. Buffers are written in rank
+//                   order, so the bytes are those printout() writes. At most four chunks per thread are
+//                   rendered ahead of the writing, bounding the memory held.
+// Parameters:       someOffset - Number of undeleted entries to skip
+//                   someCount - Number of undeleted entries to print, or -1 for all after someOffset
+//                   someThreads - Rendering threads. 0 is taken as 1.
+//                   someDescriptor - A file descriptor the threads may pwrite() their buffers to, each at the
+//                                    offset given by the sizes of the chunks before it, or -1. A descriptor
+//                                    that cannot seek (ie. a pipe) is written in order by this thread instead.
+// Preconditions:    The tree is not changed until this returns. Rendering a typeT is safe from several
+//                   threads at once (LinkedListContext::toString() is const and reads only shared settings).
+// Postconditions:   When someDescriptor was written, its offset is left at the end of the output
+// Return value:     None
+// Functions called: traverseByRank(), sizeOf(), std::thread, pwrite(), lseek()
+void printoutParallel(int someOffset, int someCount, unsigned int someThreads, int someDescriptor);
+
+// X-----------------------------X
+// |    #select(int, typeS&)    |
+// X-----------------------------X
+// Description:      Hands the entry of a given in-order rank to someSink, descending by subtree sizes
+// Parameters:       someRank - 0-based position among the undeleted entries
+//                   someSink - Callable taking a typeT&
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     true if 0 <= someRank < getSize(), false otherwise
+// Functions called: sizeOf(), someSink()
+template <class typeS>
+bool select(int someRank, typeS& someSink);
+
+// X---------------------X
+// |    #rank(typeL&)    |
+// X---------------------X
+// Description:      Counts the undeleted entries whose key is less than someValue
+// Parameters:       someValue - A key, which need not be present
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     0 to getSize(). Equals the rank of someValue when it is present.
+// Functions called: sizeOf()
+template <class typeL>
+int rank(const typeL& someValue);
+
 // #setDelete() -
-// X-------------------------X
-// |    #setDelete(typeT)    |
-// X-------------------------X
-// Description:      
+// X--------------------------X
+// |    #setDelete(typeL&)    |
+// X--------------------------X
+// Description:      Tombstones the entry with the given key. The tree is compacted once tombstones exceed
+//                   compactionPercent of its nodes, so deleted entries stop costing descent time.
+// Parameters:       someValue - Key of the entry to delete
+// Preconditions:    
+// Postconditions:   find(someValue) is false. A later insert of the key starts a fresh entry.
+// Return value:     true if an undeleted entry was deleted
+// Functions called: adjustSizes(), compactIfSparse()
+template <class typeL>
+bool setDelete(const typeL& someValue);
+
+// X----------------------------X
+// |    #setDeleteIf(typeP&)    |
+// X----------------------------X
+// Description:      Offers every undeleted entry to someTest and tombstones those it accepts.
+//                   someTest may also modify the entry, ie. to drop one document's occurrences
+//                   and accept the entry only if none remain.
+// Parameters:       someTest - Callable taking a typeT&, returning true to delete it
+// Preconditions:    
+// Postconditions:   As setDelete(), for each accepted entry
+// Return value:     Number of entries deleted
+// Functions called: setDeleteIf(nodePtr, ...), compactIfSparse()
+template <class typeP>
+int setDeleteIf(typeP& someTest);
+
+// X------------------------------------X
+// |    #setDeleteIf(typeL&, typeP&)    |
+// X------------------------------------X
+// Description:      Offers the undeleted entry with one key to someTest, tombstoning it if accepted. As with
+//                   setDeleteIf(typeP&), someTest may modify the entry, ie. to drop its expired occurrences.
+// Parameters:       someValue - Key of the entry
+//                   someTest - Callable taking a typeT&, returning true to delete it
+// Preconditions:    someTest leaves the entry's key unchanged
+// Postconditions:   As setDelete(), if the entry was accepted
+// Return value:     true if an entry was deleted
+// Functions called: setDelete()
+template <class typeL, class typeP>
+bool setDeleteIf(const typeL& someValue, typeP& someTest);
+
+// X------------------X
+// |    #compact()    |
+// X------------------X
+// Description:      Frees every tombstoned node and relinks the rest into a perfectly balanced tree.
+//                   Nodes are relinked, not copied, so no entry data is moved. O(n).
 // Parameters:       
 // Preconditions:    
-// Postconditions:   
+// Postconditions:   No tombstones remain. Tree height is floor(log2(getSize())) + 1.
 // Return value:     
-// Functions called: 
-bool setDelete(typeT someData);
+// Functions called: collectLive(), linkSorted()
+void compact();
+
+// X-------------------------------X
+// |    #bulkLoad(typeI, typeI)    |
+// X-------------------------------X
+// Description:      Replaces the tree's contents with a range of entries, building a perfectly balanced tree
+//                   in O(n) after the sort, rather than by n descents. Sorted input (ie. a persisted keyword
+//                   list) skips the sort; unsorted input is sorted in parallel when large.
+//                   Entries with equal keys are folded in range order, assigned onto the first exactly as
+//                   insert() would have done.
+// Parameters:       firstData, lastData - Iterator range over typeT. Wrap it in std::make_move_iterator to
+//                                         move the entries into the tree rather than copy them.
+// Preconditions:    
+// Postconditions:   getSize() is the number of distinct keys in the range. Tree height is floor(log2(getSize())) + 1.
+// Return value:     getSize()
+// Functions called: obliviate(), sortByKey(), linkSorted()
+template <class typeI>
+int bulkLoad(typeI firstData, typeI lastData);
 
 
 
@@ -399,6 +828,18 @@ BSTGeneric();
 // Functions called: 
 BSTGeneric(string fileAddress);
 
+// X---------------------------------X
+// |    #BSTGeneric(typeI, typeI)    |
+// X---------------------------------X
+// Constructor of the BSTGeneric class from a range of entries, sorted or not
+// Parameters:       firstData, lastData - Iterator range over typeT, as for bulkLoad()
+// Preconditions:    
+// Postconditions:   
+// Return value:     
+// Functions called: bulkLoad()
+template <class typeI>
+BSTGeneric(typeI firstData, typeI lastData);
+
 // X----------------------X
 // |    #~BSTGeneric()    |
 // X----------------------X
@@ -440,6 +881,28 @@ typeT& getRootValue();
 // Functions called: 
 string getValue();
 
+// X------------------X
+// |    #getSize()    |
+// X------------------X
+// Returns the number of undeleted entries in the tree
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     >= 0
+// Functions called: sizeOf()
+int getSize();
+
+// X-----------------------X
+// |    #getNodeBytes()    |
+// X-----------------------X
+// Returns the bytes allocated for the tree's nodes, tombstones included, excluding heap storage owned by the entries
+// Parameters:       
+// Preconditions:    
+// Postconditions:   
+// Return value:     >= 0
+// Functions called: 
+size_t getNodeBytes();
+
 // X-------------------X
 // |    #setValue()    |
 // X-------------------X
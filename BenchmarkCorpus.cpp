@@ -0,0 +1,583 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for input-output operations
+#include <iostream>
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for file stream operations (writing the corpus)
+#include <fstream>
+
+// Necessary for vector operations (the cumulative word weights)
+#include <vector>
+
+// Necessary for the random number engine and distribution
+#include <random>
+
+// Necessary for upper_bound() (inverting the cumulative weights)
+#include <algorithm>
+
+// Necessary for pow() (Zipf weights)
+#include <cmath>
+
+// Necessary for timing operations
+#include <chrono>
+
+// Necessary for remove() (deleting the scratch corpus)
+#include <cstdio>
+
+// Field and method declarations for the BenchmarkCorpus class
+#include "BenchmarkCorpus.h"
+
+// The build paths being timed, and what they read through
+#include "BSTGeneric.h"
+#include "BSTGeneric.cpp" // .cpp required here due to generic/template functionality of this class
+#include "HashTableGeneric.h"
+#include "HashTableGeneric.cpp" // .cpp required here due to generic/template functionality of this class
+#include "RadixTreeGeneric.h"
+#include "RadixTreeGeneric.cpp" // .cpp required here due to generic/template functionality of this class
+#include "ReaderCorpus.h"
+#include "LinkedListContext.h"
+#include "ArchiveCorpus.h"
+#include "WriterConcordance.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------------X
+// |    #makeWord(unsigned int)    |
+// X-------------------------------X
+// Spells someRank in bijective base 26, so every rank gets a distinct, purely alphabetic word
+string BenchmarkCorpus::makeWord(unsigned int someRank) const {
+   string retWord = "";
+   // Invariant: someRank + 1 still holds the letters not yet written, lowest first
+   unsigned int remainder = someRank + 1;
+   while (remainder > 0) {
+      remainder--;
+      retWord.insert(retWord.begin(), (char)('a' + remainder % 26));
+      remainder = remainder / 26;
+   }
+   return(retWord);
+}
+
+// X-------------------X
+// |    #generate()    |
+// X-------------------X
+// Draws each word by inverting the cumulative Zipf weights with a binary search
+bool BenchmarkCorpus::generate() {
+   ofstream fileOutputObj(corpusAddress.c_str());
+   if (!fileOutputObj) {
+      cout << "Unable to write the benchmark corpus to " << corpusAddress << endl;
+      return(false);
+   }
+   // #cumulativeWeights - Sum of the weights 1 / k^s of ranks 0 to i
+   vector<double> cumulativeWeights(vocabularySize);
+   double weightSum = 0.0;
+   for (unsigned int i = 0 ; i < vocabularySize ; i++) {
+      weightSum = weightSum + 1.0 / pow((double)(i + 1), zipfExponent);
+      cumulativeWeights[i] = weightSum;
+   }
+   // Every word is spelled once up front
+   vector<string> wordList(vocabularySize);
+   for (unsigned int i = 0 ; i < vocabularySize ; i++) {
+      wordList[i] = makeWord(i);
+   }
+   mt19937 randomEngine(randomSeed);
+   uniform_real_distribution<double> uniformWeight(0.0, weightSum);
+   for (unsigned int i = 0 ; i < tokenCount ; i++) {
+      unsigned int wordRank = upper_bound(cumulativeWeights.begin(), cumulativeWeights.end(), uniformWeight(randomEngine)) - cumulativeWeights.begin();
+      // Guard against the draw landing exactly on weightSum
+      if (wordRank >= vocabularySize) {
+         wordRank = vocabularySize - 1;
+      }
+      fileOutputObj << wordList[wordRank];
+      if (i % 12 == 11) {
+         fileOutputObj << "\n";
+      }
+      else {
+         fileOutputObj << " ";
+      }
+   }
+   fileOutputObj << "\n";
+   return(true);
+}
+
+// X---------------------X
+// |    #readCorpus()    |
+// X---------------------X
+// The Driver's read loop, recording what it would insert rather than inserting it
+double BenchmarkCorpus::readCorpus() {
+   BSTGeneric<string> stopListBST("stopwords.txt");
+   ReaderCorpus theScribe;
+   theScribe.setArchive(&corpusArchive);
+   LinkedListContext::setArchive(&corpusArchive);
+
+   chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+   theScribe.loadFile(corpusAddress);
+   theScribe.prime();
+   while (!theScribe.isFinished()) {
+      if (!stopListBST.find(theScribe.getCurrWord())) {
+         occurrencePositions.push_back(theScribe.getCurrPosition());
+         occurrenceDocuments.push_back(theScribe.getDocumentID());
+         prevContextLengths.push_back(theScribe.getPrevContext().length());
+      }
+      theScribe.advance();
+   }
+   chrono::steady_clock::time_point endTime = chrono::steady_clock::now();
+   return(chrono::duration<double>(endTime - startTime).count());
+}
+
+// X--------------------------------X
+// |    #timeBuild(int, string&)    |
+// X--------------------------------X
+// One build from the recorded occurrences. Both paths construct the same one-occurrence list per
+// occurrence, as makeLinkedListContext() does, so they differ only in where it goes.
+double BenchmarkCorpus::timeBuild(int buildMode, string& someDigest) {
+   BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword> concordanceBST;
+   HashTableGeneric<LinkedListContext> concordanceTable;
+
+   chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+   for (unsigned int i = 0 ; i < occurrencePositions.size() ; i++) {
+      unsigned int thisPosition = occurrencePositions[i];
+      LinkedListContext thisList(corpusArchive.getWord(thisPosition), thisPosition, occurrenceDocuments[i], prevContextLengths[i]);
+      if (buildMode == 1) {
+         concordanceBST.insert(std::move(thisList));
+      }
+      else {
+         concordanceTable.insert(corpusArchive.getWordID(thisPosition), std::move(thisList));
+      }
+   }
+   if (buildMode == 2) {
+      concordanceBST.bulkLoad(make_move_iterator(concordanceTable.begin()), make_move_iterator(concordanceTable.end()));
+      concordanceTable.clear();
+   }
+   chrono::steady_clock::time_point endTime = chrono::steady_clock::now();
+
+   someDigest = digestOf(concordanceBST);
+   return(chrono::duration<double>(endTime - startTime).count());
+}
+
+// X---------------------------X
+// |    #digestOf(<typeC>&)    |
+// X---------------------------X
+// Folds each keyword and its occurrence count, in order, into a 64-bit FNV-1a hash
+template <class typeC>
+string BenchmarkCorpus::digestOf(typeC& someConcordance) {
+   struct SinkDigest {
+      unsigned long long digestValue;
+      void operator()(LinkedListContext& someList) {
+         string listSummary = someList.getKeyword() + ":" + to_string(someList.getOccurrenceCount()) + ";";
+         for (unsigned int i = 0 ; i < listSummary.length() ; i++) {
+            digestValue = (digestValue ^ (unsigned char)listSummary[i]) * 1099511628211ULL;
+         }
+      }
+   } toDigest;
+   toDigest.digestValue = 14695981039346656037ULL;
+   int entryCount = someConcordance.traversePrefix("", toDigest);
+   return(to_string(entryCount) + ":" + to_string(toDigest.digestValue));
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------X
+// |    #run(int)    |
+// X-----------------X
+// Reads the corpus once, then prints the best of someRepeats builds for each path
+void BenchmarkCorpus::run(int someRepeats) {
+   if (!generate()) {
+      return;
+   }
+   double readTime = readCorpus();
+   remove(corpusAddress.c_str());
+   // #modeNames - Label of each build mode, by timeBuild() buildMode
+   const char* modeNames[3] = { "", "Tree (insert per occurrence)", "Hash (accumulate, sort once)" };
+   // #bestTimes - Fastest build of each mode, in seconds
+   double bestTimes[3] = { 0.0, 0.0, 0.0 };
+   // #modeDigests - In-order digest of each mode
+   string modeDigests[3];
+   for (int mode = 1 ; mode < 3 ; mode++) {
+      for (int i = 0 ; i < someRepeats ; i++) {
+         double buildTime = timeBuild(mode, modeDigests[mode]);
+         if (i == 0 || buildTime < bestTimes[mode]) {
+            bestTimes[mode] = buildTime;
+         }
+      }
+   }
+
+   cout << "Zipfian benchmark: " << tokenCount << " tokens, " << vocabularySize << " word vocabulary, exponent "
+        << zipfExponent << endl;
+   cout << "   Reading (shared by both paths): " << (readTime * 1000.0) << " ms, "
+        << occurrencePositions.size() << " occurrences, " << corpusArchive.getVocabularySize() << " distinct words" << endl;
+   for (int mode = 1 ; mode < 3 ; mode++) {
+      cout << "   " << modeNames[mode] << ": " << (bestTimes[mode] * 1000.0) << " ms, best of " << someRepeats << endl;
+   }
+   cout << "   Ordered output identical: " << (modeDigests[1] == modeDigests[2] ? "yes" : "NO") << endl;
+}
+
+// X----------------------------X
+// |    #compareIndexes(int)    |
+// X----------------------------X
+// Builds once per index, since a second build would only fold into the first; lookups and prefix
+// enumeration are read-only, so those take the best of someRepeats rounds
+void BenchmarkCorpus::compareIndexes(int someRepeats) {
+   double readTime = readCorpus();
+   BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword> concordanceBST;
+   RadixTreeGeneric<LinkedListContext, LinkedListContext::KeyKeyword> concordanceRadix;
+   // #buildTimes - Seconds to insert every occurrence: [0] the tree, [1] the radix tree
+   double buildTimes[2];
+   for (int index = 0 ; index < 2 ; index++) {
+      chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+      for (unsigned int i = 0 ; i < occurrencePositions.size() ; i++) {
+         unsigned int thisPosition = occurrencePositions[i];
+         LinkedListContext thisList(corpusArchive.getWord(thisPosition), thisPosition, occurrenceDocuments[i], prevContextLengths[i]);
+         if (index == 0) {
+            concordanceBST.insert(std::move(thisList));
+         }
+         else {
+            concordanceRadix.insert(std::move(thisList));
+         }
+      }
+      buildTimes[index] = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+   }
+
+   // #lookupKeys - Every keyword, plus each with a letter appended (mostly absent), shuffled so neither
+   //               index is walked in key order
+   vector<string> lookupKeys;
+   // #prefixKeys - Each distinct leading pair of letters among the keywords (a one-letter keyword gives itself)
+   vector<string> prefixKeys;
+   auto toKeys = [&lookupKeys, &prefixKeys](LinkedListContext& someList) {
+      const string& thisKeyword = someList.getKeyword();
+      lookupKeys.push_back(thisKeyword);
+      lookupKeys.push_back(thisKeyword + "q");
+      string thisPrefix = thisKeyword.substr(0, 2);
+      if (prefixKeys.empty() || prefixKeys.back() != thisPrefix) {
+         prefixKeys.push_back(thisPrefix);
+      }
+   };
+   concordanceRadix.traversePrefix("", toKeys);
+   shuffle(lookupKeys.begin(), lookupKeys.end(), mt19937(randomSeed));
+
+   // #bestLookups, #bestPrefixes - Fastest round of each measurement: [0] the tree, [1] the radix tree
+   double bestLookups[2] = { 0.0, 0.0 };
+   double bestPrefixes[2] = { 0.0, 0.0 };
+   // #foundCounts, #matchCounts - Keys found and prefix matches per round, to check the indexes agree
+   int foundCounts[2] = { 0, 0 };
+   int matchCounts[2] = { 0, 0 };
+   auto toNothing = [](LinkedListContext&) { };
+   for (int round = 0 ; round < someRepeats ; round++) {
+      for (int index = 0 ; index < 2 ; index++) {
+         int foundCount = 0;
+         chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+         for (unsigned int i = 0 ; i < lookupKeys.size() ; i++) {
+            if (index == 0 ? concordanceBST.find(lookupKeys[i]) : concordanceRadix.find(lookupKeys[i])) {
+               foundCount++;
+            }
+         }
+         double lookupTime = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+         int matchCount = 0;
+         startTime = chrono::steady_clock::now();
+         for (unsigned int i = 0 ; i < prefixKeys.size() ; i++) {
+            if (index == 0) {
+               matchCount += concordanceBST.traversePrefix(prefixKeys[i], toNothing);
+            }
+            else {
+               matchCount += concordanceRadix.traversePrefix(prefixKeys[i], toNothing);
+            }
+         }
+         double prefixTime = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+         if (round == 0 || lookupTime < bestLookups[index]) {
+            bestLookups[index] = lookupTime;
+         }
+         if (round == 0 || prefixTime < bestPrefixes[index]) {
+            bestPrefixes[index] = prefixTime;
+         }
+         foundCounts[index] = foundCount;
+         matchCounts[index] = matchCount;
+      }
+   }
+
+   int entryCount = concordanceRadix.getSize();
+   // #nodeBytes - Node memory of each index, and what it costs per entry beyond the entry itself
+   size_t nodeBytes[2] = { concordanceBST.getNodeBytes(), concordanceRadix.getNodeBytes() };
+   const char* indexNames[2] = { "BSTGeneric", "RadixTreeGeneric" };
+   cout << "Index comparison: " << corpusAddress << ", " << occurrencePositions.size() << " occurrences, "
+        << entryCount << " keywords, read in " << (readTime * 1000.0) << " ms" << endl;
+   for (int index = 0 ; index < 2 ; index++) {
+      cout << "   " << indexNames[index] << ":" << endl;
+      cout << "      Node memory: " << nodeBytes[index] << " bytes, "
+           << (entryCount > 0 ? ((double)nodeBytes[index] / entryCount - sizeof(LinkedListContext)) : 0.0)
+           << " bytes per keyword beyond its " << sizeof(LinkedListContext) << "-byte entry" << endl;
+      cout << "      Build: " << (buildTimes[index] * 1000.0) << " ms" << endl;
+      cout << "      Lookup: " << (lookupKeys.empty() ? 0.0 : bestLookups[index] * 1.0e9 / lookupKeys.size())
+           << " ns per key over " << lookupKeys.size() << " keys, best of " << someRepeats << endl;
+      cout << "      Prefix enumeration: " << (bestPrefixes[index] * 1000.0) << " ms for " << prefixKeys.size()
+           << " prefixes, best of " << someRepeats << endl;
+   }
+   cout << "   Keys found identical: " << (foundCounts[0] == foundCounts[1] ? "yes" : "NO") << endl;
+   cout << "   Prefix matches identical: " << (matchCounts[0] == matchCounts[1] ? "yes" : "NO") << endl;
+   cout << "   Ordered output identical: " << (digestOf(concordanceBST) == digestOf(concordanceRadix) ? "yes" : "NO") << endl;
+}
+
+// X------------------------------X
+// |    #compareRenderers(int)    |
+// X------------------------------X
+// The bytes go to a stream that only counts them, so the timings hold the rendering alone
+void BenchmarkCorpus::compareRenderers(int someRepeats) {
+   double readTime = readCorpus();
+   BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword> concordanceBST;
+   for (unsigned int i = 0 ; i < occurrencePositions.size() ; i++) {
+      unsigned int thisPosition = occurrencePositions[i];
+      concordanceBST.insert(LinkedListContext(corpusArchive.getWord(thisPosition), thisPosition, occurrenceDocuments[i], prevContextLengths[i]));
+   }
+
+   // #SinkCount - A stream buffer that counts what is written to it and keeps none of it
+   struct SinkCount : public streambuf {
+      unsigned long long byteCount = 0;
+      int overflow(int someChar) {
+         byteCount++;
+         return(someChar);
+      }
+      streamsize xsputn(const char*, streamsize someCount) {
+         byteCount = byteCount + someCount;
+         return(someCount);
+      }
+   };
+   // #rendererNames - The KWIC text, then each record format by its WriterConcordance value
+   const char* rendererNames[4] = { "KWIC text", "JSON Lines", "TSV", "Binary" };
+   // #bestTimes, #byteCounts - Fastest round of each renderer, and the bytes it produced
+   double bestTimes[4] = { 0.0, 0.0, 0.0, 0.0 };
+   unsigned long long byteCounts[4] = { 0, 0, 0, 0 };
+   for (int round = 0 ; round < someRepeats ; round++) {
+      for (int renderer = 0 ; renderer < 4 ; renderer++) {
+         SinkCount countBuffer;
+         ostream countStream(&countBuffer);
+         chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+         if (renderer == 0) {
+            auto toText = [&countStream](LinkedListContext& someList) {
+               countStream << someList;
+            };
+            concordanceBST.traversePrefix("", toText);
+         }
+         else {
+            WriterConcordance recordWriter(renderer, countStream);
+            auto toRecords = [&recordWriter](LinkedListContext& someList) {
+               someList.writeRecords(recordWriter);
+            };
+            concordanceBST.traversePrefix("", toRecords);
+            recordWriter.flush();
+         }
+         double renderTime = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+         if (round == 0 || renderTime < bestTimes[renderer]) {
+            bestTimes[renderer] = renderTime;
+         }
+         byteCounts[renderer] = countBuffer.byteCount;
+      }
+   }
+
+   cout << "Renderer comparison: " << corpusAddress << ", " << occurrencePositions.size() << " occurrences, "
+        << concordanceBST.getSize() << " keywords, read in " << (readTime * 1000.0) << " ms" << endl;
+   for (int renderer = 0 ; renderer < 4 ; renderer++) {
+      cout << "   " << rendererNames[renderer] << ": " << (bestTimes[renderer] * 1000.0) << " ms, " << byteCounts[renderer]
+           << " bytes, " << (bestTimes[renderer] > 0.0 ? byteCounts[renderer] / bestTimes[renderer] / 1.0e6 : 0.0)
+           << " MB/s, best of " << someRepeats << endl;
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------------------------------------------------------------------X
+// |    #BenchmarkCorpus(unsigned int, unsigned int, double, unsigned int, string)    |
+// X----------------------------------------------------------------------------------X
+// Stores the corpus parameters. A vocabulary of 0 is raised to 1.
+BenchmarkCorpus::BenchmarkCorpus(unsigned int someTokenCount, unsigned int someVocabularySize, double someExponent, unsigned int someSeed, string someAddress) {
+   tokenCount = someTokenCount;
+   vocabularySize = someVocabularySize;
+   if (vocabularySize == 0) {
+      vocabularySize = 1;
+   }
+   zipfExponent = someExponent;
+   randomSeed = someSeed;
+   corpusAddress = someAddress;
+}
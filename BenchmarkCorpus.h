@@ -0,0 +1,397 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for vector operations (the recorded occurrences)
+#include <vector>
+
+// Token store the recorded occurrences point into
+#include "ArchiveCorpus.h"
+
+using namespace std;
+
+// X------------------------X
+// |    #BenchmarkCorpus    |
+// X------------------------X
+// Description: Times the concordance build paths against each other on a synthetic corpus whose word
+//              frequencies follow Zipf's law (the k-th most common word occurs in proportion to 1 / k^s),
+//              the shape of natural-language text. The corpus is written to a file and read once through
+//              ReaderCorpus, exactly as the Driver reads; the occurrences it yields are then replayed
+//              into each build path, so the timings hold the build cost alone.
+//              compareIndexes() reads a real corpus file instead and sets the BSTGeneric concordance against
+//              the RadixTreeGeneric one: node memory, build, lookup and prefix enumeration.
+//              compareRenderers() reads a real corpus file and times the KWIC text against the record formats.
+class BenchmarkCorpus {
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------X
+// |    #tokenCount    |
+// X-------------------X
+// Number of words in the generated corpus.
+// Invariant information: 
+unsigned int tokenCount;
+
+// X-----------------------X
+// |    #vocabularySize    |
+// X-----------------------X
+// Number of distinct words the generator draws from.
+// Invariant information: >= 1
+unsigned int vocabularySize;
+
+// X---------------------X
+// |    #zipfExponent    |
+// X---------------------X
+// Exponent s of the Zipf distribution. Around 1 for English; larger is more skewed.
+// Invariant information: >= 0
+double zipfExponent;
+
+// X-------------------X
+// |    #randomSeed    |
+// X-------------------X
+// Seed of the generator, so a corpus can be reproduced.
+// Invariant information: 
+unsigned int randomSeed;
+
+// X----------------------X
+// |    #corpusAddress    |
+// X----------------------X
+// File the corpus is written to, removed once run() finishes; or the real corpus compareIndexes() reads.
+// Invariant information: 
+string corpusAddress;
+
+// X----------------------X
+// |    #corpusArchive    |
+// X----------------------X
+// Archive filled by readCorpus(). Every recorded occurrence is a position in it.
+// Invariant information: 
+ArchiveCorpus corpusArchive;
+
+// X----------------------------X
+// |    #occurrencePositions    |
+// X----------------------------X
+// Archive position of each non-stopword occurrence, in reading order.
+// Invariant information: Same length as occurrenceDocuments and prevContextLengths
+vector<unsigned int> occurrencePositions;
+
+// X----------------------------X
+// |    #occurrenceDocuments    |
+// X----------------------------X
+// Document of each recorded occurrence.
+// Invariant information: 
+vector<unsigned int> occurrenceDocuments;
+
+// X---------------------------X
+// |    #prevContextLengths    |
+// X---------------------------X
+// Length of the previous-context string of each recorded occurrence, as ReaderCorpus formats it.
+// Invariant information: 
+vector<int> prevContextLengths;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------------X
+// |    #makeWord(unsigned int)    |
+// X-------------------------------X
+// Description:      Spells a word rank in letters, bijective base 26: 0 is "a", 25 is "z", 26 is "aa"
+// Parameters:       someRank - 0-based frequency rank
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     A lowercase word, distinct for each rank
+// Functions called: None
+string makeWord(unsigned int someRank) const;
+
+// X-------------------X
+// |    #generate()    |
+// X-------------------X
+// Description:      Writes tokenCount Zipf-distributed words to corpusAddress, twelve to a line
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   corpusAddress holds the corpus
+// Return value:     true if the file was written
+// Functions called: makeWord(), upper_bound()
+bool generate();
+
+// X---------------------X
+// |    #readCorpus()    |
+// X---------------------X
+// Description:      Reads the corpus through ReaderCorpus against the stoplist, as the Driver does, and
+//                   records every occurrence the Driver would insert
+// Parameters:       None
+// Preconditions:    corpusAddress holds a corpus, generated or given
+// Postconditions:   corpusArchive and the occurrence lists are filled
+// Return value:     Seconds taken
+// Functions called: ReaderCorpus::advance(), BSTGeneric::find()
+double readCorpus();
+
+// X--------------------------------X
+// |    #timeBuild(int, string&)    |
+// X--------------------------------X
+// Description:      Builds a concordance from the recorded occurrences with one of the build paths, timed
+// Parameters:       buildMode - 1 inserts into the tree per occurrence,
+//                               2 accumulates in a hash table and bulk-loads the tree at the end
+//                   someDigest - Receives a hash of the in-order keywords and their occurrence counts,
+//                                to check the paths agree
+// Preconditions:    readCorpus() has run
+// Postconditions:   None
+// Return value:     Seconds taken, excluding the digest
+// Functions called: BSTGeneric::insert(), HashTableGeneric::insert(), BSTGeneric::bulkLoad()
+double timeBuild(int buildMode, string& someDigest);
+
+// X---------------------------X
+// |    #digestOf(<typeC>&)    |
+// X---------------------------X
+// Description:      Hashes the in-order keywords and their occurrence counts of a concordance, so
+//                   concordances built different ways can be checked against each other
+// Parameters:       someConcordance - BSTGeneric or RadixTreeGeneric of LinkedListContext
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     "<entries>:<64-bit FNV-1a hash>"
+// Functions called: traversePrefix()
+template <class typeC>
+string digestOf(typeC& someConcordance);
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------X
+// |    #run(int)    |
+// X-----------------X
+// Description:      Generates and reads the corpus, times every build path someRepeats times, and prints
+//                   the best time of each alongside whether their outputs agree
+// Parameters:       someRepeats - Timed builds per path
+// Preconditions:    stopwords.txt is readable, as for the Driver
+// Postconditions:   The corpus file is removed
+// Return value:     None
+// Functions called: generate(), readCorpus(), timeBuild()
+void run(int someRepeats);
+
+// X----------------------------X
+// |    #compareIndexes(int)    |
+// X----------------------------X
+// Description:      Reads the corpus at corpusAddress and builds its concordance in a BSTGeneric and in a
+//                   RadixTreeGeneric, then prints each index's node memory, build time, best of someRepeats
+//                   rounds looking up every keyword (and as many absent words), and best of someRepeats
+//                   rounds enumerating every two-letter prefix the keywords start with
+// Parameters:       someRepeats - Timed rounds per lookup and prefix measurement
+// Preconditions:    stopwords.txt is readable, as for the Driver
+// Postconditions:   The corpus file is left in place
+// Return value:     None
+// Functions called: readCorpus(), digestOf(), BSTGeneric::find(), RadixTreeGeneric::find(), traversePrefix()
+void compareIndexes(int someRepeats);
+
+// X------------------------------X
+// |    #compareRenderers(int)    |
+// X------------------------------X
+// Description:      Reads the corpus at corpusAddress, builds its concordance, and renders the whole of it
+//                   as aligned KWIC text and in each WriterConcordance format, discarding the bytes. Prints
+//                   the best of someRepeats rounds for each, with its size and throughput.
+// Parameters:       someRepeats - Timed rounds per renderer
+// Preconditions:    stopwords.txt is readable, as for the Driver
+// Postconditions:   The corpus file is left in place
+// Return value:     None
+// Functions called: readCorpus(), traversePrefix(), LinkedListContext::toString(), LinkedListContext::writeRecords()
+void compareRenderers(int someRepeats);
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------------------------------------------------------------------X
+// |    #BenchmarkCorpus(unsigned int, unsigned int, double, unsigned int, string)    |
+// X----------------------------------------------------------------------------------X
+// Description:      Sets up a benchmark. Nothing is generated until run(); compareIndexes() only needs someAddress.
+// Parameters:       someTokenCount - Corpus length in words, ie. 1000000
+//                   someVocabularySize - Distinct words, ie. 50000
+//                   someExponent - Zipf exponent, ie. 1.1
+//                   someSeed - Generator seed
+//                   someAddress - Scratch file for the corpus, or the corpus for compareIndexes()
+BenchmarkCorpus(unsigned int someTokenCount, unsigned int someVocabularySize, double someExponent, unsigned int someSeed, string someAddress);
+
+}; // Closing class BenchmarkCorpus
@@ -19,6 +19,34 @@
 // LinkedListContext.h
 // LinkedListContext.cpp
 // NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// IndexSuffix.h
+// IndexSuffix.cpp
+// AutomatonPattern.h
+// AutomatonPattern.cpp
+// WriterConcordance.h
+// WriterConcordance.cpp
 // stopwords.txt (recommended)
 // Corpus (not named, name must be passed as a command argument)
 //
@@ -169,6 +197,48 @@
 // Necessary for string operations
 #include <string>
 
+// Necessary for vector operations (corpus address list)
+#include <vector>
+
+// Necessary for atoi(), atof() and strtoull() on command arguments
+#include <cstdlib>
+
+// Necessary for std::make_move_iterator (moving the hash table's lists into the tree)
+#include <iterator>
+
+// Necessary for the snapshot reader thread and its stop flag (-snapshots), the follow writer (-follow), and
+// the collocation tally threads (-collocates)
+#include <thread>
+#include <atomic>
+
+// Necessary for the follow writer's poll interval (-follow)
+#include <chrono>
+
+// Necessary for the lock shared by the follow writer and the queries when a window is kept (-follow with -window)
+#include <mutex>
+
+// Necessary for the queue of token runs handed to the collocation tally threads (-collocates)
+#include <condition_variable>
+#include <deque>
+
+// Necessary for setprecision() (the collocation scores)
+#include <iomanip>
+
+// Necessary for istringstream (splitting a phrase query into words)
+#include <sstream>
+
+// Necessary for ofstream (the file machine-readable records are written to)
+#include <fstream>
+
+// Necessary for hash set operations (the keywords trimmed in one slide of the window)
+#include <unordered_set>
+
+// Necessary for hash map operations (the per-keyword counters of -counts)
+#include <unordered_map>
+
+// Necessary for sort() (ordering the keyword counts)
+#include <algorithm>
+
 // The NodeGeneric used in a BSTGeneric class
 // #include "NodeGeneric.cpp"
 
@@ -182,6 +252,46 @@
 // The LinkedListContext class - Used as a data field in a Concordance Node
 #include "LinkedListContext.h"
 
+// The ArchiveCorpus class - Token store that concordance occurrences point into
+#include "ArchiveCorpus.h"
+
+// The HashTableGeneric class - Unordered accumulator for the hash build mode (-hash)
+#include "HashTableGeneric.h"
+#include "HashTableGeneric.cpp" // .cpp required here due to generic/template functionality of this class
+
+// The BSTConcurrent class - Snapshot-published tree read by another thread during ingestion (-snapshots)
+#include "BSTConcurrent.h"
+#include "BSTConcurrent.cpp" // .cpp required here due to generic/template functionality of this class
+
+// The RadixTreeGeneric class - Adaptive radix tree the concordance is built in instead of the BST (-radix)
+#include "RadixTreeGeneric.h"
+#include "RadixTreeGeneric.cpp" // .cpp required here due to generic/template functionality of this class
+
+// The StoreConcordance class - Saves a built concordance (-save), appends new text to it (-append) and restores it (-load)
+#include "StoreConcordance.h"
+
+// The BenchmarkCorpus class - Times the build modes on a Zipfian corpus (-benchmark), and compares the
+// tree index with the radix tree index on a real one (-indexreport)
+#include "BenchmarkCorpus.h"
+
+// The SketchFrequency class - Counts the most frequent keywords in fixed memory (-topk)
+#include "SketchFrequency.h"
+
+// The SketchCountMin class - Screens out the phrases too rare to keep before they are stored (-ngram)
+#include "SketchCountMin.h"
+
+// The TallyCollocation class - Counts each keyword's neighbours as the corpus is read (-collocates)
+#include "TallyCollocation.h"
+
+// The IndexSuffix class - Suffix array over the archive answering phrase queries (-phrase, -saveindex, -index)
+#include "IndexSuffix.h"
+
+// The AutomatonPattern class - Wildcard and regular expression keyword queries (-match, -regex)
+#include "AutomatonPattern.h"
+
+// The WriterConcordance class - JSON Lines, TSV and binary records in place of the KWIC text (-format)
+#include "WriterConcordance.h"
+
 // Methods not found in the current namespace are directed to check the 'std' namespace
 using namespace std;
 
@@ -207,6 +317,319 @@ int main( int argc, char* argv[] ) {  // Array of command-line arguments strings
 
 // Omitted for assignment submission
 
+   // #corpusAddresses - Every non-flag command argument is a corpus document, read in order
+   vector<string> corpusAddresses;
+   // #documentFilter - Document to display (-doc <id>), or -1 to display all documents
+   int documentFilter = -1;
+   // #byDocument - Display one concordance per document (-bydoc) rather than a merged concordance
+   bool byDocument = false;
+   // #queryPrefix - Display only keywords starting with this prefix (-prefix <p>), if set
+   string queryPrefix = "";
+   // #queryLow, #queryHigh - Display only keywords between these inclusive bounds (-range <low> <high>), if set
+   string queryLow = "";
+   string queryHigh = "";
+   // #pageOffset, #pageCount - Display only keywords pageOffset to pageOffset + pageCount - 1 (-page <offset> <count>)
+   int pageOffset = 0;
+   int pageCount = 0;
+   // #removedKeywords - Keywords deleted from the concordance before display (-remove <keyword>, repeatable)
+   vector<string> removedKeywords;
+   // #removedDocuments - Documents whose occurrences are deleted before display (-removedoc <id>, repeatable)
+   vector<unsigned int> removedDocuments;
+   // #queryPattern, #isRegex - Display only keywords matching this wildcard (-match <w>) or regular expression
+   //                         (-regex <r>), if set
+   string queryPattern = "";
+   bool isRegex = false;
+   // #queryMode - 0 displays the whole concordance, 1 a prefix query, 2 a range query, 3 a page, 4 a pattern
+   int queryMode = 0;
+   // #hashBuild - Accumulate occurrences in a hash table and sort the keywords once at the end (-hash)
+   bool hashBuild = false;
+   // #radixBuild - Build the concordance in an adaptive radix tree and answer -prefix from it (-radix)
+   bool radixBuild = false;
+   // #benchmarkTokens, #benchmarkVocabulary, #benchmarkExponent - Zipfian corpus to time the build modes on
+   //                                                             instead (-benchmark <tokens> <vocabulary> <exponent>)
+   unsigned int benchmarkTokens = 0;
+   unsigned int benchmarkVocabulary = 0;
+   double benchmarkExponent = 0.0;
+   // #indexReport - Compare BSTGeneric and RadixTreeGeneric on the first corpus document instead (-indexreport)
+   bool indexReport = false;
+   // #renderReport - Time the KWIC text against each record format on the first corpus document instead (-renderreport)
+   bool renderReport = false;
+   // #snapshotEvery - Ingest through a BSTConcurrent publishing every N occurrences while a reader thread
+   //                  queries the published snapshots (-snapshots <N>), or 0 to build directly
+   unsigned int snapshotEvery = 0;
+   // #saveAddress - File the built concordance is saved to (-save <file>), if set
+   string saveAddress = "";
+   // #appendAddress - Saved concordance that the corpus arguments are appended to (-append <file>), if set.
+   //                  The first argument continues the saved run's last document; any others are new documents.
+   //                  Only the store's tail is read, and the concordance of the new text alone is displayed.
+   string appendAddress = "";
+   // #loadAddress - Saved concordance restored whole before the corpus arguments are read as new documents
+   //                (-load <file>), if set
+   string loadAddress = "";
+   // #followMillis - Follow the first corpus as another process appends to it, polling every followMillis ms and
+   //                 answering the prefixes typed on stdin until "quit" or end of input (-follow <ms>), or 0 to read once
+   int followMillis = 0;
+   // #windowTokens - Keep only the occurrences among the last windowTokens words read, expiring older ones
+   //                 as the window slides (-window <N>), or 0 to keep every occurrence
+   unsigned int windowTokens = 0;
+   // #countOnly - Count each keyword's occurrences instead of building the concordance (-counts)
+   bool countOnly = false;
+   // #byCount - List the counts most frequent first rather than alphabetically (-bycount, implies -counts)
+   bool byCount = false;
+   // #topCount - List only the topCount most frequent keywords, counted in fixed memory (-topk <K>), or 0
+   unsigned int topCount = 0;
+   // #topCounters - Counters the -topk sketch may hold (-counters <M>), or 0 for ten per keyword listed
+   unsigned int topCounters = 0;
+   // #occurrenceCap - Most occurrences kept per keyword, sampled uniformly past it (-cap <N>), or 0 to keep all
+   unsigned int occurrenceCap = 0;
+   // #sampleSeed - Seed the capped keywords are sampled under (-seed <S>)
+   unsigned long long sampleSeed = 1;
+   // #collapseRepeats - Display each distinct 11-word window of a keyword once, with its multiplicity (-dedup)
+   bool collapseRepeats = false;
+   // #ngramLength - Words per keyword: phrases of this many words replace single-word keywords (-ngram <n>)
+   unsigned int ngramLength = 1;
+   // #ngramMinimum - Fewest occurrences a phrase needs to be kept (-minfreq <f>)
+   unsigned int ngramMinimum = 2;
+   // #collocateCount - List each keyword's collocateCount strongest collocates instead of its contexts
+   //                   (-collocates <K>), or 0 to display the concordance
+   unsigned int collocateCount = 0;
+   // #collocateSpan - Tokens either side of a keyword counted as its neighbours (-span <w>)
+   unsigned int collocateSpan = 5;
+   // #collocateThreads - Threads tallying the neighbours beside the one reading (-threads <T>), or 0 to tally
+   //                     on the reading thread. One fewer than the hardware threads unless set.
+   unsigned int collocateThreads = (thread::hardware_concurrency() > 1) ? thread::hardware_concurrency() - 1 : 0;
+   // #phraseQueries - Phrases whose every occurrence is displayed in place of the concordance (-phrase "<words>",
+   //                  repeatable), found through a suffix index over the archive
+   vector<string> phraseQueries;
+   // #saveIndexAddress - File the suffix index of the corpus read is saved to (-saveindex <file>), if set
+   string saveIndexAddress = "";
+   // #indexAddress - Saved suffix index to answer the phrase queries from, without reading any corpus
+   //                 (-index <file>), if set
+   string indexAddress = "";
+   // #renderThreads - Threads formatting the concordance display into buffers (-render <T>), or 0 to format
+   //                  and write it entry by entry on this thread
+   unsigned int renderThreads = 0;
+   // #renderOffsets - Whether the rendering threads write their buffers straight to standard output at offsets
+   //                  (-pwrite). Output that cannot seek (a pipe or terminal) is written in order instead.
+   bool renderOffsets = false;
+   // #formatName - Record format the display is written in instead of aligned KWIC text (-format <jsonl|tsv|binary>),
+   //               or "" for the text
+   string formatName = "";
+   // #outputAddress - File the records are written to (-output <file>), or "" for standard output
+   string outputAddress = "";
+   // #fixedPrevWidth, #fixedKeywordWidth - Column widths every line is cut or padded to (-fixedwidth <P> <K>),
+   //                                       or 0 to widen them to the longest context and keyword read
+   int fixedPrevWidth = 0;
+   int fixedKeywordWidth = 0;
+   // #prescanWidths - Read the corpora once for the words alone and fix the widths the build would widen to,
+   //                  before building (-prescan)
+   bool prescanWidths = false;
+   for (int i = 1 ; i < argc ; i++) {
+      string anArgument = argv[i];
+      if (anArgument == "-doc" && i + 1 < argc) {
+         documentFilter = atoi(argv[++i]);
+      }
+      else if (anArgument == "-bydoc") {
+         byDocument = true;
+      }
+      else if (anArgument == "-prefix" && i + 1 < argc) {
+         queryPrefix = argv[++i];
+         queryMode = 1;
+      }
+      else if (anArgument == "-range" && i + 2 < argc) {
+         queryLow = argv[++i];
+         queryHigh = argv[++i];
+         queryMode = 2;
+      }
+      else if ((anArgument == "-match" || anArgument == "-regex") && i + 1 < argc) {
+         queryPattern = argv[++i];
+         isRegex = (anArgument == "-regex");
+         queryMode = 4;
+      }
+      else if (anArgument == "-remove" && i + 1 < argc) {
+         removedKeywords.push_back(argv[++i]);
+      }
+      else if (anArgument == "-removedoc" && i + 1 < argc) {
+         removedDocuments.push_back(atoi(argv[++i]));
+      }
+      else if (anArgument == "-hash") {
+         hashBuild = true;
+      }
+      else if (anArgument == "-radix") {
+         radixBuild = true;
+      }
+      else if (anArgument == "-snapshots" && i + 1 < argc) {
+         snapshotEvery = atoi(argv[++i]);
+      }
+      else if (anArgument == "-save" && i + 1 < argc) {
+         saveAddress = argv[++i];
+      }
+      else if (anArgument == "-append" && i + 1 < argc) {
+         appendAddress = argv[++i];
+      }
+      else if (anArgument == "-load" && i + 1 < argc) {
+         loadAddress = argv[++i];
+      }
+      else if (anArgument == "-window" && i + 1 < argc) {
+         windowTokens = atoi(argv[++i]);
+      }
+      else if (anArgument == "-follow" && i + 1 < argc) {
+         followMillis = atoi(argv[++i]);
+      }
+      else if (anArgument == "-counts") {
+         countOnly = true;
+      }
+      else if (anArgument == "-bycount") {
+         countOnly = true;
+         byCount = true;
+      }
+      else if (anArgument == "-topk" && i + 1 < argc) {
+         topCount = atoi(argv[++i]);
+      }
+      else if (anArgument == "-counters" && i + 1 < argc) {
+         topCounters = atoi(argv[++i]);
+      }
+      else if (anArgument == "-cap" && i + 1 < argc) {
+         occurrenceCap = atoi(argv[++i]);
+      }
+      else if (anArgument == "-seed" && i + 1 < argc) {
+         sampleSeed = strtoull(argv[++i], nullptr, 10);
+      }
+      else if (anArgument == "-dedup") {
+         collapseRepeats = true;
+      }
+      else if (anArgument == "-ngram" && i + 1 < argc) {
+         ngramLength = atoi(argv[++i]);
+      }
+      else if (anArgument == "-minfreq" && i + 1 < argc) {
+         ngramMinimum = atoi(argv[++i]);
+      }
+      else if (anArgument == "-collocates" && i + 1 < argc) {
+         collocateCount = atoi(argv[++i]);
+      }
+      else if (anArgument == "-span" && i + 1 < argc) {
+         collocateSpan = atoi(argv[++i]);
+      }
+      else if (anArgument == "-threads" && i + 1 < argc) {
+         collocateThreads = atoi(argv[++i]);
+      }
+      else if (anArgument == "-phrase" && i + 1 < argc) {
+         phraseQueries.push_back(argv[++i]);
+      }
+      else if (anArgument == "-saveindex" && i + 1 < argc) {
+         saveIndexAddress = argv[++i];
+      }
+      else if (anArgument == "-index" && i + 1 < argc) {
+         indexAddress = argv[++i];
+      }
+      else if (anArgument == "-render" && i + 1 < argc) {
+         renderThreads = atoi(argv[++i]);
+      }
+      else if (anArgument == "-pwrite") {
+         renderOffsets = true;
+      }
+      else if (anArgument == "-format" && i + 1 < argc) {
+         formatName = argv[++i];
+      }
+      else if (anArgument == "-output" && i + 1 < argc) {
+         outputAddress = argv[++i];
+      }
+      else if (anArgument == "-fixedwidth" && i + 2 < argc) {
+         fixedPrevWidth = max(atoi(argv[++i]), 1);
+         fixedKeywordWidth = max(atoi(argv[++i]), 1);
+      }
+      else if (anArgument == "-prescan") {
+         prescanWidths = true;
+      }
+      else if (anArgument == "-renderreport") {
+         renderReport = true;
+      }
+      else if (anArgument == "-indexreport") {
+         indexReport = true;
+      }
+      else if (anArgument == "-benchmark" && i + 3 < argc) {
+         benchmarkTokens = atoi(argv[++i]);
+         benchmarkVocabulary = atoi(argv[++i]);
+         benchmarkExponent = atof(argv[++i]);
+      }
+      else if (anArgument == "-page" && i + 2 < argc) {
+         pageOffset = atoi(argv[++i]);
+         pageCount = atoi(argv[++i]);
+         queryMode = 3;
+      }
+      else {
+         corpusAddresses.push_back(anArgument);
+      }
+   }
+   // Occurrences are expired from the tree in place, so the hash and snapshot builds keep them all
+   if (windowTokens > 0 && (hashBuild || snapshotEvery > 0)) {
+      cout << "-window applies to the tree build only. Keeping every occurrence." << endl;
+      windowTokens = 0;
+   }
+   // An append run archives only the new text, after the store's last words: its documents and positions
+   // are numbered from the tail of the store, and the store is added to in place
+   if (appendAddress != "" && (loadAddress != "" || saveAddress != "" || windowTokens > 0 || followMillis > 0 || byDocument
+                               || documentFilter >= 0 || !removedDocuments.empty() || formatName != "" || !phraseQueries.empty()
+                               || saveIndexAddress != "")) {
+      cout << "-append does not combine with -load, -save, -window, -follow, -bydoc, -doc, -removedoc, -format, -phrase "
+           << "or -saveindex. Reading the corpora without appending." << endl;
+      appendAddress = "";
+   }
+   // A sample keeps exact totals only while occurrences are added, and the saved format holds no totals
+   if (occurrenceCap > 0 && (windowTokens > 0 || !removedDocuments.empty() || saveAddress != "" || appendAddress != "" || loadAddress != "")) {
+      cout << "-cap does not combine with -window, -removedoc, -save, -append or -load. Keeping every occurrence." << endl;
+      occurrenceCap = 0;
+   }
+   // Phrases are found once the whole corpus is archived, and a saved keyword must be a single word
+   if (ngramLength > 1 && (windowTokens > 0 || snapshotEvery > 0 || followMillis > 0 || saveAddress != "" || appendAddress != ""
+                           || loadAddress != "")) {
+      cout << "-ngram does not combine with -window, -snapshots, -follow, -save, -append or -load. Using single words." << endl;
+      ngramLength = 1;
+   }
+   // Neighbours are counted once, over every document read in this run, and listed for the whole corpus
+   if (collocateCount > 0 && (windowTokens > 0 || followMillis > 0 || ngramLength > 1 || appendAddress != "" || loadAddress != ""
+                              || !removedDocuments.empty() || documentFilter >= 0 || byDocument || queryMode == 3)) {
+      cout << "-collocates does not combine with -window, -follow, -ngram, -append, -load, -removedoc, -doc, -bydoc or -page. "
+           << "Displaying the concordance." << endl;
+      collocateCount = 0;
+   }
+   // The suffix index covers every position read, so the archive must keep them all, as they were read
+   if ((!phraseQueries.empty() || saveIndexAddress != "") && (windowTokens > 0 || followMillis > 0)) {
+      cout << "-phrase and -saveindex do not combine with -window or -follow. Displaying the concordance." << endl;
+      phraseQueries.clear();
+      saveIndexAddress = "";
+   }
+   // The radix tree is built from the plain read and answers prefix queries alone; everything else runs on the BST
+   if (radixBuild && (hashBuild || snapshotEvery > 0 || followMillis > 0 || windowTokens > 0 || appendAddress != "" || loadAddress != ""
+                      || saveAddress != ""
+                      || !removedKeywords.empty() || !removedDocuments.empty() || ngramLength > 1 || collocateCount > 0
+                      || !phraseQueries.empty() || byDocument || formatName != "" || renderThreads > 0 || queryMode > 1)) {
+      cout << "-radix does not combine with -hash, -snapshots, -follow, -window, -append, -load, -save, -remove, -removedoc, -ngram, "
+           << "-collocates, -phrase, -bydoc, -format, -render, -range, -page, -match or -regex. Building the BST." << endl;
+      radixBuild = false;
+   }
+   // The pre-scan sees single words in the files named, as they stand before this run reads them
+   if (prescanWidths && (fixedPrevWidth > 0 || ngramLength > 1 || !phraseQueries.empty() || appendAddress != "" || loadAddress != ""
+                         || followMillis > 0)) {
+      cout << "-prescan does not combine with -fixedwidth, -ngram, -phrase, -append, -load or -follow. Widening as the corpus is read." << endl;
+      prescanWidths = false;
+   }
+   // Records carry their own document and position, and list every occurrence kept
+   if (formatName != "" && (collapseRepeats || byDocument || collocateCount > 0 || !phraseQueries.empty() || renderThreads > 0)) {
+      cout << "-format does not combine with -dedup, -bydoc, -collocates, -phrase or -render. Displaying the concordance as text." << endl;
+      formatName = "";
+   }
+   // Count and top-K modes tally every keyword of every document as the words stream past: there is no
+   // archive to filter, query or render from, and no phrase is formed
+   if ((countOnly || topCount > 0) && (documentFilter >= 0 || ngramLength > 1 || !removedKeywords.empty() || !removedDocuments.empty()
+                                       || windowTokens > 0 || appendAddress != "" || loadAddress != "" || followMillis > 0 || queryMode > 0
+                                       || !phraseQueries.empty() || collocateCount > 0 || formatName != "")) {
+      cout << "-counts and -topk do not combine with -doc, -ngram, -remove, -removedoc, -window, -append, -load, -follow, -prefix, "
+           << "-range, -page, -match, -regex, -phrase, -collocates or -format. Displaying the concordance." << endl;
+      countOnly = false;
+      topCount = 0;
+   }
+
 
 
 //-------|---------|---------|---------|---------|---------|---------|---------|
@@ -250,7 +673,202 @@ int main( int argc, char* argv[] ) {  // Array of command-line arguments strings
 //
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
-   if (true) { // Note to grader: This switch decoupled from control variables for assignment submission
+   // The record format and its destination are checked before any reading. Records go through a writer
+   // that buffers them whole, to the output file if one is given.
+   int outputFormat = 0;
+   ofstream outputFile;
+   if (formatName != "") {
+      outputFormat = WriterConcordance::parseFormat(formatName);
+      if (outputFormat == 0) {
+         cout << "Unable to recognize format \"" << formatName << "\" (jsonl, tsv or binary). Closing program..." << endl;
+         return(1);
+      }
+      if (outputAddress != "") {
+         outputFile.open(outputAddress, ios::out | ios::binary | ios::trunc);
+         if (!outputFile.is_open()) {
+            cout << "Unable to open output file " << outputAddress << ". Closing program..." << endl;
+            return(1);
+         }
+      }
+   }
+   WriterConcordance recordWriter(outputFormat, (outputAddress != "") ? (ostream&)outputFile : cout);
+
+   // Fixed widths hold from the first line rendered, in every mode
+   if (fixedPrevWidth > 0) {
+      LinkedListContext::setFixedWidths(fixedPrevWidth, fixedKeywordWidth);
+   }
+
+   // Keywords are stored lowercased, so patterns are too. A malformed pattern is reported before any reading.
+   AutomatonPattern keywordPattern;
+   if (queryMode == 4) {
+      for (size_t i = 0 ; i < queryPattern.length() ; i++) {
+         queryPattern[i] = tolower(queryPattern[i]);
+      }
+      if (!(isRegex ? keywordPattern.compileRegex(queryPattern) : keywordPattern.compileWildcard(queryPattern))) {
+         cout << "Unable to compile pattern \"" << queryPattern << "\". Closing program..." << endl;
+         return(1);
+      }
+   }
+
+   // Finds a phrase's occurrences through a suffix index and displays them as one concordance entry keyed
+   // by the phrase. The query's words are cleaned as the reader cleans the corpus: lowercased, and trimmed
+   // to run from their first letter to their last. A word never read cannot occur.
+   auto displayPhrase = [](const IndexSuffix& someIndex, const ArchiveCorpus& someArchive, const string& somePhrase) {
+      istringstream phraseStream(somePhrase);
+      string aWord;
+      string phraseKeyword = "";
+      vector<unsigned int> phraseIDs;
+      bool isKnown = true;
+      while (phraseStream >> aWord) {
+         size_t firstLetter = string::npos;
+         size_t lastLetter = 0;
+         for (size_t i = 0 ; i < aWord.length() ; i++) {
+            aWord[i] = tolower(aWord[i]);
+            if (aWord[i] >= 'a' && aWord[i] <= 'z') {
+               firstLetter = (firstLetter == string::npos) ? i : firstLetter;
+               lastLetter = i;
+            }
+         }
+         if (firstLetter == string::npos) {
+            continue;
+         }
+         aWord = aWord.substr(firstLetter, lastLetter - firstLetter + 1);
+         phraseKeyword = (phraseKeyword == "") ? aWord : phraseKeyword + " " + aWord;
+         unsigned int wordID = 0;
+         isKnown = isKnown && someArchive.findWordID(aWord, wordID);
+         phraseIDs.push_back(wordID);
+      }
+      vector<unsigned int> phrasePositions;
+      if (isKnown) {
+         phrasePositions = someIndex.find(phraseIDs);
+      }
+      if (phrasePositions.empty()) {
+         cout << "No occurrences of \"" << phraseKeyword << "\"" << endl;
+         return;
+      }
+      // Positions arrive ascending, so each occurrence merges onto the end of the list
+      LinkedListContext::setPhraseLength(phraseIDs.size());
+      LinkedListContext phraseList(phraseKeyword, phrasePositions[0], someArchive.getDocumentOf(phrasePositions[0]),
+                                   someArchive.getPrevContext(phrasePositions[0]).length());
+      for (unsigned int i = 1 ; i < phrasePositions.size() ; i++) {
+         phraseList = LinkedListContext(phraseKeyword, phrasePositions[i], someArchive.getDocumentOf(phrasePositions[i]),
+                                        someArchive.getPrevContext(phrasePositions[i]).length());
+      }
+      cout << phraseList;
+   };
+
+   // Benchmark runs replace the normal concordance
+   if (benchmarkTokens > 0) {
+      BenchmarkCorpus theBenchmark(benchmarkTokens, benchmarkVocabulary, benchmarkExponent, 1, "benchmark_zipf.txt");
+      theBenchmark.run(3);
+   }
+   else if (renderReport && !corpusAddresses.empty()) {
+      BenchmarkCorpus theBenchmark(0, 0, 0.0, 1, corpusAddresses[0]);
+      theBenchmark.compareRenderers(3);
+   }
+   else if (indexReport && !corpusAddresses.empty()) {
+      BenchmarkCorpus theBenchmark(0, 0, 0.0, 1, corpusAddresses[0]);
+      theBenchmark.compareIndexes(3);
+   }
+   // Index mode maps a saved suffix index and answers the phrase queries from it alone: no corpus is read,
+   // no stoplist loaded and no concordance built, and the arrays are read only where the queries touch them
+   else if (indexAddress != "") {
+      IndexSuffix theIndex;
+      ArchiveCorpus theArchive;
+      if (!theIndex.open(indexAddress) || !theIndex.attachArchive(theArchive)) {
+         cout << "Unable to open index " << indexAddress << ". Closing program..." << endl;
+         return(1);
+      }
+      LinkedListContext::setArchive(&theArchive);
+      LinkedListContext::setOccurrenceCap(occurrenceCap, sampleSeed);
+      LinkedListContext::setCollapseRepeats(collapseRepeats);
+      LinkedListContext::setDocumentFilter(documentFilter);
+      for (unsigned int i = 0 ; i < phraseQueries.size() ; i++) {
+         displayPhrase(theIndex, theArchive, phraseQueries[i]);
+      }
+      cout << "Index " << indexAddress << ": " << theIndex.getTokenCount() << " words in " << theIndex.getDocumentCount() << " documents" << endl;
+   }
+   // Top-K mode streams the stoplist-filtered words through a Space-Saving sketch of fixed size, so memory
+   // does not grow with the vocabulary however much text is read
+   else if (topCount > 0) {
+      BSTGeneric<string> stopListBST("stopwords.txt");
+      ReaderCorpus theScribe;
+      for (unsigned int i = 0 ; i < corpusAddresses.size() ; i++) {
+         theScribe.loadFile(corpusAddresses[i]);
+      }
+      SketchFrequency theSketch((topCounters > 0) ? topCounters : 10 * topCount);
+      string aWord;
+      while (theScribe.readWord(aWord)) {
+         if (!stopListBST.find(aWord)) {
+            theSketch.add(aWord);
+         }
+      }
+      vector<SketchFrequency::Counter> rankedCounters = theSketch.rank();
+      unsigned int listedCount = (topCount < rankedCounters.size()) ? topCount : rankedCounters.size();
+      unsigned int keywordWidth = 0;
+      for (unsigned int i = 0 ; i < listedCount ; i++) {
+         if (rankedCounters[i].word.length() > keywordWidth) {
+            keywordWidth = rankedCounters[i].word.length();
+         }
+      }
+      for (unsigned int i = 0 ; i < listedCount ; i++) {
+         cout << rankedCounters[i].word << string(keywordWidth - rankedCounters[i].word.length() + 2, ' ') << rankedCounters[i].count;
+         if (rankedCounters[i].error > 0) {
+            cout << "  (at most " << rankedCounters[i].error << " over)";
+         }
+         cout << endl;
+      }
+      cout << "Top " << listedCount << " of " << theSketch.getStreamLength() << " occurrences, " << theSketch.getCapacity() << " counters. ";
+      if (theSketch.isExact()) {
+         cout << "Every count is exact." << endl;
+      }
+      else {
+         cout << "No count exceeds the true count by more than " << theSketch.getErrorBound() << " (N/M = "
+              << theSketch.getStreamLength() / theSketch.getCapacity() << "). The first " << theSketch.countGuaranteed(rankedCounters, listedCount)
+              << " listed are certainly the true top ones." << endl;
+      }
+   }
+   // Count mode reads the same words through the same stoplist, but keeps one counter per keyword: no
+   // archive, no context window and no occurrence lists, so it runs at the speed of the tokenizer
+   else if (countOnly) {
+      BSTGeneric<string> stopListBST("stopwords.txt");
+      ReaderCorpus theScribe;
+      for (unsigned int i = 0 ; i < corpusAddresses.size() ; i++) {
+         theScribe.loadFile(corpusAddresses[i]);
+      }
+      // #wordCounts - Occurrences of each distinct word, stopwords included until the counts are listed
+      unordered_map<string, unsigned int> wordCounts;
+      string aWord;
+      while (theScribe.readWord(aWord)) {
+         wordCounts[aWord]++;
+      }
+      // The stoplist is checked once per distinct word rather than once per occurrence
+      vector< pair<string, unsigned int> > keywordCounts;
+      unsigned long long occurrenceCount = 0;
+      unsigned int keywordWidth = 0;
+      for (auto countIt = wordCounts.begin() ; countIt != wordCounts.end() ; ++countIt) {
+         if (!stopListBST.find(countIt->first)) {
+            keywordCounts.push_back(*countIt);
+            occurrenceCount = occurrenceCount + countIt->second;
+            if (countIt->first.length() > keywordWidth) {
+               keywordWidth = countIt->first.length();
+            }
+         }
+      }
+      if (byCount) {
+         sort(keywordCounts.begin(), keywordCounts.end(), [](const pair<string, unsigned int>& a, const pair<string, unsigned int>& b) {
+            return(a.second != b.second ? a.second > b.second : a.first < b.first);
+         });
+      }
+      else {
+         sort(keywordCounts.begin(), keywordCounts.end());
+      }
+      for (unsigned int i = 0 ; i < keywordCounts.size() ; i++) {
+         cout << keywordCounts[i].first << string(keywordWidth - keywordCounts[i].first.length() + 2, ' ') << keywordCounts[i].second << endl;
+      }
+      cout << keywordCounts.size() << " keywords, " << occurrenceCount << " occurrences" << endl;
+   }
+   else { // Note to grader: This switch decoupled from control variables for assignment submission
 
 
 
@@ -259,12 +877,57 @@ int main( int argc, char* argv[] ) {  // Array of command-line arguments strings
 // X-----------------------X
       BSTGeneric<string> stopListBST("stopwords.txt");
 
+      // A pre-scan reads the words alone, as count mode does, noting per distinct word the longest previous
+      // context it has. Those of the keywords fix the widths the build would otherwise widen to, so the
+      // lines come out the same, and each is final as soon as it is rendered.
+      if (prescanWidths) {
+         ReaderCorpus scanScribe;
+         for (unsigned int i = 0 ; i < corpusAddresses.size() ; i++) {
+            scanScribe.loadFile(corpusAddresses[i]);
+         }
+         // #contextWidths - Longest previous context of each distinct word, stopwords included until the widths are taken
+         unordered_map<string, int> contextWidths;
+         // #recentLengths - Lengths of the last five words of the current document, in a ring; 0 before its start
+         int recentLengths[5] = { 0, 0, 0, 0, 0 };
+         unsigned int recentIndex = 0;
+         unsigned int scanDocument = scanScribe.getDocumentID();
+         string aWord;
+         while (scanScribe.readWord(aWord)) {
+            if (scanScribe.getDocumentID() != scanDocument) {
+               scanDocument = scanScribe.getDocumentID();
+               fill(recentLengths, recentLengths + 5, 0);
+            }
+            // Five slots, each a word (or nothing, before the document start) and a space
+            int prevWidth = 5 + recentLengths[0] + recentLengths[1] + recentLengths[2] + recentLengths[3] + recentLengths[4];
+            int& widestContext = contextWidths[aWord];
+            widestContext = max(widestContext, prevWidth);
+            recentLengths[recentIndex] = aWord.length();
+            recentIndex = (recentIndex + 1) % 5;
+         }
+         int prevWidth = 0;
+         int keywordWidth = 0;
+         for (auto widthIt = contextWidths.begin() ; widthIt != contextWidths.end() ; ++widthIt) {
+            if (!stopListBST.find(widthIt->first)) {
+               prevWidth = max(prevWidth, widthIt->second);
+               keywordWidth = max(keywordWidth, (int)widthIt->first.length());
+            }
+         }
+         LinkedListContext::setFixedWidths(prevWidth, keywordWidth);
+      }
+
 
 
 // X-----------------------------X
 // |    Make a ConcordanceBST    |
 // X-----------------------------X
-      BSTGeneric<LinkedListContext> concordanceBST;
+      // Ordered by keyword, so keyword lookups, bounds and deletes compare against the keyword directly
+      BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword> concordanceBST;
+      // Hash build mode accumulates here by interned keyword ID, and is emptied into the tree after reading
+      HashTableGeneric<LinkedListContext> concordanceTable;
+      // Radix build mode inserts here instead of the BST, and the display is drawn from it
+      RadixTreeGeneric<LinkedListContext, LinkedListContext::KeyKeyword> concordanceRadix;
+      // Snapshot and follow modes ingest here, publishing every snapshotEvery (or 4096) occurrences or 100 ms
+      BSTConcurrent<LinkedListContext, LinkedListContext::KeyKeyword> concordanceSnapshots((snapshotEvery > 0) ? snapshotEvery : 4096, 100);
 
 
 
@@ -273,39 +936,604 @@ int main( int argc, char* argv[] ) {  // Array of command-line arguments strings
 // X----------------------------X
       ReaderCorpus theScribe;
 
-      // Load the corpus to the reader
-      theScribe.loadFile(argv[1]);
+      // Every word read is archived, and concordance occurrences are positions into it
+      ArchiveCorpus theArchive;
+      theScribe.setArchive(&theArchive);
+      LinkedListContext::setArchive(&theArchive);
+      LinkedListContext::setOccurrenceCap(occurrenceCap, sampleSeed);
+      LinkedListContext::setCollapseRepeats(collapseRepeats);
+      LinkedListContext::setPhraseLength(ngramLength);
+
+      // Load the corpora to the reader. Each file is its own document, and contexts reset between them.
+      // #documentAddresses - The corpora that opened, indexed by document ID
+      vector<string> documentAddresses;
+      // #theStore - The store an append run resumes from and adds its segment to
+      StoreConcordance theStore(appendAddress);
+      // In follow mode only the first corpus is opened, and it is read as it grows (see Read the corpus)
+      if (followMillis > 0) {
+         if (!corpusAddresses.empty() && theScribe.follow(corpusAddresses[0])) {
+            documentAddresses.push_back(corpusAddresses[0]);
+         }
+      }
+      else {
+         // #firstNewAddress - Index of the first corpus argument to load as a document of its own
+         unsigned int firstNewAddress = 0;
+         // In load mode the whole store is restored first, and the corpora are read after it as new documents
+         if (loadAddress != "" && !StoreConcordance(loadAddress).load(documentAddresses, theArchive, concordanceBST)) {
+            cout << "Unable to load concordance " << loadAddress << ". Closing program..." << endl;
+            return(1);
+         }
+         // In append mode only the store's tail is read, and reading resumes where its last document stopped
+         if (appendAddress != "") {
+            if (!theStore.resume(documentAddresses, theArchive)) {
+               cout << "Unable to load concordance " << appendAddress << ". Closing program..." << endl;
+               return(1);
+            }
+            if (!corpusAddresses.empty() && theScribe.resume(corpusAddresses[0])) {
+               firstNewAddress = 1;
+            }
+         }
+         for (unsigned int i = firstNewAddress ; i < corpusAddresses.size() ; i++) {
+            if (theScribe.loadFile(corpusAddresses[i])) {
+               documentAddresses.push_back(corpusAddresses[i]);
+            }
+         }
+
+         // Prime the reader so that its current word is the first word of the corpus
+         theScribe.prime();
+      }
+
+      // In snapshot mode a reader thread renders the prefix query (or everything) from each snapshot
+      // while the corpus is read, noting how far each snapshot trailed the writer
+      // #readingDone - Set once the last snapshot is published, stopping the reader
+      atomic<bool> readingDone(false);
+      // #snapshotsRead, #versionsSeen, #largestStaleness - What the reader observed
+      unsigned long long snapshotsRead = 0;
+      unsigned long long versionsSeen = 0;
+      unsigned long long largestStaleness = 0;
+      thread snapshotReader;
+      if (snapshotEvery > 0) {
+         snapshotReader = thread([&]() {
+            unsigned long long lastVersion = 0;
+            size_t renderedLength = 0;
+            auto toRendered = [&renderedLength](const LinkedListContext& someList) { renderedLength += someList.toString().length(); };
+            while (!readingDone.load()) {
+               // Count first: every insert counted had happened before the snapshot was taken
+               unsigned long long writerCount = concordanceSnapshots.getInsertCount();
+               BSTConcurrent<LinkedListContext, LinkedListContext::KeyKeyword>::Snapshot thisSnapshot = concordanceSnapshots.getSnapshot();
+               unsigned long long thisStaleness = (writerCount > thisSnapshot.getInsertCount()) ? writerCount - thisSnapshot.getInsertCount() : 0;
+               if (thisStaleness > largestStaleness) {
+                  largestStaleness = thisStaleness;
+               }
+               if (thisSnapshot.getVersion() != lastVersion) {
+                  lastVersion = thisSnapshot.getVersion();
+                  versionsSeen++;
+               }
+               thisSnapshot.traversePrefix(queryPrefix, toRendered);
+               snapshotsRead++;
+            }
+         });
+      }
+
+      // A window keeps the occurrences among the last windowTokens positions. It slides in batches of an eighth
+      // of its length: each token leaving it names a keyword to trim, and a keyword with nothing left is
+      // deleted. Once the expired tokens outnumber the window, the archive discards them and every position
+      // is renumbered, so memory stays bounded however long the input runs.
+      // #windowStart - First position inside the window; every occurrence before it has been expired
+      unsigned int windowStart = 0;
+      // #windowBatch - Positions the window must trail by before it slides
+      unsigned int windowBatch = (windowTokens / 8 > 0) ? windowTokens / 8 : 1;
+      // #treeLock - Held by the follow writer while it changes the tree, and by each query while it reads it
+      mutex treeLock;
+      auto slideWindow = [&](unsigned int endPosition, bool isExact) {
+         if (windowTokens == 0 || endPosition < windowStart + windowTokens + (isExact ? 0 : windowBatch)) {
+            return;
+         }
+         unsigned int windowCutoff = endPosition - windowTokens;
+         auto expireTest = [windowCutoff](LinkedListContext& someList) {
+            return(someList.expireBefore(windowCutoff));
+         };
+         unordered_set<unsigned int> trimmedWords;
+         for (unsigned int position = windowStart ; position < windowCutoff ; position++) {
+            if (trimmedWords.insert(theArchive.getWordID(position)).second) {
+               concordanceBST.setDeleteIf(theArchive.getWord(position), expireTest);
+            }
+         }
+         windowStart = windowCutoff;
+         // Five tokens are kept before the window as the previous context of its first keywords
+         if (windowStart >= windowTokens + 5) {
+            unsigned int discardCount = windowStart - 5;
+            theArchive.discardBefore(discardCount);
+            auto toShifted = [discardCount](LinkedListContext& someList) {
+               someList.shiftPositions(discardCount);
+            };
+            concordanceBST.traversePrefix("", toShifted);
+            theScribe.shiftPositions(discardCount);
+            windowStart = windowStart - discardCount;
+         }
+      };
+
 
-      // Prime the reader so that its current word is the first word of the corpus
-      theScribe.prime();
+
+      // In collocation mode the reading loop hands every word on to be tallied as it goes: a keyword as its
+      // word ID, a stopword as a gap, and span gaps between documents. Runs of collocationRunLength words
+      // (plus the 2 * span either side that their windows reach into) go to the tally threads through a
+      // short queue, each thread counting into its own TallyCollocation. They are merged once reading ends,
+      // so the counts are the same however many threads share the work.
+      // #collocationTallies - One tally per tally thread, or a single tally filled by the reading thread
+      vector<TallyCollocation> collocationTallies((collocateThreads > 0) ? collocateThreads : 1, TallyCollocation(collocateSpan));
+      // #collocationRun - Words read since the last run was handed off, after the 2 * span it overlaps it by
+      vector<unsigned int> collocationRun;
+      // #collocationDocument - Document of the last word fed, or -1 before the first
+      int collocationDocument = -1;
+      const size_t collocationRunLength = 65536;
+      // #collocationQueue, #collocationLock, #collocationSignal, #collocationDone - Runs waiting for a tally
+      //                                                                           thread, and its hand-off
+      deque< vector<unsigned int> > collocationQueue;
+      mutex collocationLock;
+      condition_variable collocationSignal;
+      bool collocationDone = false;
+      vector<thread> collocationWorkers;
+      if (collocateCount > 0) {
+         for (unsigned int t = 0 ; t < collocateThreads ; t++) {
+            collocationWorkers.push_back(thread([&, t]() {
+               unique_lock<mutex> queueGuard(collocationLock);
+               while (true) {
+                  collocationSignal.wait(queueGuard, [&]() { return(collocationDone || !collocationQueue.empty()); });
+                  if (collocationQueue.empty()) {
+                     return;
+                  }
+                  vector<unsigned int> thisRun = std::move(collocationQueue.front());
+                  collocationQueue.pop_front();
+                  collocationSignal.notify_all();
+                  queueGuard.unlock();
+                  collocationTallies[t].addRun(thisRun, collocateSpan, thisRun.size() - collocateSpan);
+                  queueGuard.lock();
+               }
+            }));
+         }
+      }
+      // Hands off the words fed so far, keeping the last 2 * span to start the next run with. The last run
+      // is closed with span gaps, so every word fed is counted exactly once.
+      auto dispatchRun = [&](bool isLast) {
+         if (isLast) {
+            collocationRun.insert(collocationRun.end(), collocateSpan, TallyCollocation::gapToken);
+         }
+         if (collocationRun.size() <= 2 * collocateSpan) {
+            return;
+         }
+         vector<unsigned int> nextRun(collocationRun.end() - 2 * collocateSpan, collocationRun.end());
+         if (collocateThreads == 0) {
+            collocationTallies[0].addRun(collocationRun, collocateSpan, collocationRun.size() - collocateSpan);
+         }
+         else {
+            unique_lock<mutex> queueGuard(collocationLock);
+            // At most two runs wait per thread, so a slow tally holds the reader back rather than filling memory
+            collocationSignal.wait(queueGuard, [&]() { return(collocationQueue.size() < 2 * collocateThreads); });
+            collocationQueue.push_back(std::move(collocationRun));
+            collocationSignal.notify_all();
+         }
+         collocationRun = std::move(nextRun);
+      };
+      auto feedCollocation = [&](unsigned int someToken, unsigned int someDocumentID) {
+         if ((int)someDocumentID != collocationDocument) {
+            collocationRun.insert(collocationRun.end(), collocateSpan, TallyCollocation::gapToken);
+            collocationDocument = someDocumentID;
+         }
+         collocationRun.push_back(someToken);
+         if (collocationRun.size() >= collocationRunLength + 2 * collocateSpan) {
+            dispatchRun(false);
+         }
+      };
 
 
 
 // X-----------------------X
 // |    Read the corpus    |
 // X-----------------------X
-      // While the reader has not reached the end...
-      while (!theScribe.isFinished()) {
-         // Check to see if the current word appears on the stoplist. If not...
-         if (!stopListBST.find(theScribe.getCurrWord())) {
-            // attempt to insert the current LinkedListContext output
-            LinkedListContext* thisList = theScribe.makeLinkedListContext();
-            concordanceBST.insert(*thisList); // ERROR: Leaks coming from this line
-            delete thisList;
+      if (followMillis > 0) {
+         // A writer thread reads whatever has been appended every followMillis ms and publishes it at once,
+         // while this thread answers the prefix queries typed on stdin from the latest snapshot
+         // #followDone - Set once the query input ends, leaving the writer one last read
+         atomic<bool> followDone(false);
+         thread followWriter([&]() {
+            bool lastRead = false;
+            while (!lastRead) {
+               lastRead = followDone.load();
+               unsigned int firstNew = theArchive.getTokenCount();
+               unsigned int wordsRead = theScribe.readAppended(lastRead);
+               // With a window the writer changes the tree in place, so it excludes the queries meanwhile
+               unique_lock<mutex> treeGuard(treeLock, defer_lock);
+               if (windowTokens > 0) {
+                  treeGuard.lock();
+               }
+               // New words are keywords at once: their contexts are rebuilt from the archive, so a post
+               // context fills in as later words arrive rather than holding the keyword back until they do
+               for (unsigned int position = firstNew ; position < firstNew + wordsRead ; position++) {
+                  string aWord = theArchive.getWord(position);
+                  if (!stopListBST.find(aWord)) {
+                     LinkedListContext newList(aWord, position, theScribe.getDocumentID(), theArchive.getPrevContext(position).length());
+                     if (windowTokens > 0) {
+                        concordanceBST.insert(std::move(newList));
+                     }
+                     else {
+                        concordanceSnapshots.insert(std::move(newList));
+                     }
+                  }
+               }
+               if (windowTokens > 0) {
+                  slideWindow(theArchive.getTokenCount(), true);
+                  treeGuard.unlock();
+               }
+               else if (concordanceSnapshots.getPendingCount() > 0) {
+                  concordanceSnapshots.publish();
+               }
+               if (wordsRead == 0 && !lastRead) {
+                  this_thread::sleep_for(chrono::milliseconds(followMillis));
+               }
+            }
+         });
+         auto toQuery = [](const LinkedListContext& someList) {
+            cout << someList;
+         };
+         string queryLine;
+         while (getline(cin, queryLine) && queryLine != "quit") {
+            if (windowTokens > 0) {
+               lock_guard<mutex> treeGuard(treeLock);
+               concordanceBST.traversePrefix(queryLine, toQuery);
+               cout << "Window: " << concordanceBST.getSize() << " keywords in the last " << windowTokens << " words" << endl;
+               continue;
+            }
+            BSTConcurrent<LinkedListContext, LinkedListContext::KeyKeyword>::Snapshot thisSnapshot = concordanceSnapshots.getSnapshot();
+            thisSnapshot.traversePrefix(queryLine, toQuery);
+            cout << "Snapshot " << thisSnapshot.getVersion() << ": " << thisSnapshot.getSize() << " keywords, "
+                 << thisSnapshot.getInsertCount() << " occurrences" << endl;
+         }
+         followDone.store(true);
+         followWriter.join();
+      }
+      else {
+         // While the reader has not reached the end...
+         while (!theScribe.isFinished()) {
+            // Check to see if the current word appears on the stoplist. If not... (phrases are found after reading)
+            bool isKeyword = (ngramLength < 2 && !stopListBST.find(theScribe.getCurrWord()));
+            if (isKeyword) {
+               // attempt to insert the current LinkedListContext output, moving it into the table or tree
+               if (snapshotEvery > 0) {
+                  concordanceSnapshots.insert(theScribe.makeLinkedListContext());
+               }
+               else if (hashBuild) {
+                  concordanceTable.insert(theArchive.getWordID(theScribe.getCurrPosition()), theScribe.makeLinkedListContext());
+               }
+               else if (radixBuild) {
+                  concordanceRadix.insert(theScribe.makeLinkedListContext());
+               }
+               else {
+                  concordanceBST.insert(theScribe.makeLinkedListContext());
+               }
+            }
+            if (collocateCount > 0) {
+               unsigned int thisPosition = theScribe.getCurrPosition();
+               feedCollocation(isKeyword ? theArchive.getWordID(thisPosition) : TallyCollocation::gapToken, theArchive.getDocumentOf(thisPosition));
+            }
+            slideWindow(theScribe.getCurrPosition() + 1, false);
+            // And move the reader up one word
+            theScribe.advance();
+         } // Closing while-loop. Reader has parsed the entire corpus.
+         // Settle the window on exactly the last windowTokens words
+         slideWindow(theArchive.getTokenCount(), true);
+      }
+
+      // Hand off the last run, let the tally threads drain the queue, and merge their tallies into the first
+      if (collocateCount > 0) {
+         dispatchRun(true);
+         {
+            lock_guard<mutex> queueGuard(collocationLock);
+            collocationDone = true;
+         }
+         collocationSignal.notify_all();
+         for (unsigned int t = 0 ; t < collocationWorkers.size() ; t++) {
+            collocationWorkers[t].join();
+         }
+         for (unsigned int t = 1 ; t < collocationTallies.size() ; t++) {
+            collocationTallies[0].merge(collocationTallies[t]);
+            collocationTallies[t] = TallyCollocation(collocateSpan);
+         }
+      }
+
+      // Sort the distinct keywords once, building the tree the queries and display below run on.
+      // Appended lists are merged into the loaded tree instead, one descent per new keyword.
+      if (hashBuild) {
+         if (concordanceBST.getSize() == 0) {
+            concordanceBST.bulkLoad(make_move_iterator(concordanceTable.begin()), make_move_iterator(concordanceTable.end()));
          }
-         // And move the reader up one word
-         theScribe.advance();
-      } // Closing while-loop. Reader has parsed the entire corpus.
+         else {
+            for (auto tableIt = concordanceTable.begin() ; tableIt != concordanceTable.end() ; ++tableIt) {
+               concordanceBST.insert(std::move(*tableIt));
+            }
+         }
+         concordanceTable.clear();
+      }
+      // Publish the tail, stop the reader, and copy the final version into the tree the queries run on
+      if (snapshotEvery > 0 || (followMillis > 0 && windowTokens == 0)) {
+         concordanceSnapshots.publish();
+         readingDone.store(true);
+         if (snapshotReader.joinable()) {
+            snapshotReader.join();
+            cout << "Snapshot reader: " << snapshotsRead << " snapshots read, " << versionsSeen << " versions seen, largest staleness "
+                 << largestStaleness << " occurrences (publishing every " << snapshotEvery << ")" << endl;
+         }
+         vector<LinkedListContext> finalLists;
+         auto toFinal = [&finalLists](const LinkedListContext& someList) {
+            finalLists.emplace_back();
+            finalLists.back() = someList;
+         };
+         concordanceSnapshots.getSnapshot().traversePrefix("", toFinal);
+         if (concordanceBST.getSize() == 0) {
+            concordanceBST.bulkLoad(make_move_iterator(finalLists.begin()), make_move_iterator(finalLists.end()));
+         }
+         else {
+            for (unsigned int i = 0 ; i < finalLists.size() ; i++) {
+               concordanceBST.insert(std::move(finalLists[i]));
+            }
+         }
+      }
+
+      // In n-gram mode every keyword is a run of ngramLength words within one document that neither starts
+      // nor ends with a stopword. Each run is identified by a rolling hash of its word IDs, so no phrase
+      // string is built until the phrase is known to be frequent enough. The first pass counts every run in
+      // a Count-Min sketch, whose estimates never undercount; the second inserts only the runs estimated
+      // at ngramMinimum or more, and the lists that truly fall short are then deleted. Memory grows with
+      // the phrases that pass the sketch rather than with every run in the corpus.
+      if (ngramLength > 1) {
+         // #isStopword - Whether each interned word is on the stoplist, checked once per word
+         vector<bool> isStopword(theArchive.getVocabularySize());
+         for (unsigned int i = 0 ; i < isStopword.size() ; i++) {
+            isStopword[i] = stopListBST.find(theArchive.getVocabularyWord(i));
+         }
+         // #ngramSketch - Four rows of one counter per token (at least 1024), two bytes each
+         SketchCountMin ngramSketch((theArchive.getTokenCount() > 1024) ? theArchive.getTokenCount() : 1024, 4);
+         // #rollingBase, #leadingPower - The hash is sum(ID_k * rollingBase^(n-1-k)) mod 2^64 over the run's
+         //                                IDs (each plus one), so the outgoing ID is removed by leadingPower
+         const unsigned long long rollingBase = 0x100000001B3ULL;
+         unsigned long long leadingPower = 1;
+         for (unsigned int i = 1 ; i < ngramLength ; i++) {
+            leadingPower = leadingPower * rollingBase;
+         }
+         auto scanPhrases = [&](bool isCounting) {
+            for (unsigned int documentID = 0 ; documentID < theArchive.getDocumentCount() ; documentID++) {
+               unsigned int documentStart = theArchive.getDocumentStart(documentID);
+               unsigned int documentEnd = (documentID + 1 < theArchive.getDocumentCount()) ? theArchive.getDocumentStart(documentID + 1) : theArchive.getTokenCount();
+               unsigned long long rollingHash = 0;
+               for (unsigned int position = documentStart ; position < documentEnd ; position++) {
+                  if (position >= documentStart + ngramLength) {
+                     rollingHash = rollingHash - (theArchive.getWordID(position - ngramLength) + 1ULL) * leadingPower;
+                  }
+                  rollingHash = rollingHash * rollingBase + (theArchive.getWordID(position) + 1ULL);
+                  if (position + 1 < documentStart + ngramLength) {
+                     continue;
+                  }
+                  unsigned int firstPosition = position + 1 - ngramLength;
+                  if (isStopword[theArchive.getWordID(firstPosition)] || isStopword[theArchive.getWordID(position)]) {
+                     continue;
+                  }
+                  if (isCounting) {
+                     ngramSketch.add(rollingHash);
+                  }
+                  else if (ngramSketch.estimate(rollingHash) >= ngramMinimum) {
+                     string aPhrase = theArchive.getVocabularyWord(theArchive.getWordID(firstPosition));
+                     for (unsigned int k = firstPosition + 1 ; k <= position ; k++) {
+                        aPhrase = aPhrase + " " + theArchive.getVocabularyWord(theArchive.getWordID(k));
+                     }
+                     concordanceBST.insert(LinkedListContext(aPhrase, firstPosition, documentID, theArchive.getPrevContext(firstPosition).length()));
+                  }
+               }
+            }
+         };
+         scanPhrases(true);
+         scanPhrases(false);
+         // The sketch may overcount where its rows collide, so the exact counts settle which phrases stay
+         auto isRare = [ngramMinimum](LinkedListContext& someList) {
+            return(someList.getOccurrenceTotal() < ngramMinimum);
+         };
+         concordanceBST.setDeleteIf(isRare);
+      }
+
+      // The suffix index is sorted once the whole corpus is archived, whatever the concordance holds
+      IndexSuffix theIndex;
+      if (!phraseQueries.empty() || saveIndexAddress != "") {
+         theIndex.build(theArchive);
+         if (saveIndexAddress != "" && !theIndex.save(saveIndexAddress, theArchive)) {
+            cout << "Unable to save index " << saveIndexAddress << "." << endl;
+         }
+      }
+
+      // Save the concordance as built, before any deletion, so a later run can append to it
+      if (saveAddress != "") {
+         StoreConcordance(saveAddress).save(documentAddresses, theArchive, concordanceBST);
+      }
+      // An append run adds what it read to the store as one segment, leaving the rest of the store unread
+      if (appendAddress != "") {
+         theStore.append(documentAddresses, theArchive, concordanceBST);
+      }
+
+
+
+// X----------------------------X
+// |    Apply the Deletions    |
+// X----------------------------X
+      for (unsigned int i = 0 ; i < removedKeywords.size() ; i++) {
+         concordanceBST.setDelete(removedKeywords[i]);
+      }
+      // #TestDocument - Drops one document's occurrences from a list, accepting the list for deletion once empty
+      struct TestDocument {
+         unsigned int documentID;
+         bool operator()(LinkedListContext& someList) {
+            return(someList.removeDocument(documentID));
+         }
+      } dropDocument;
+      for (unsigned int i = 0 ; i < removedDocuments.size() ; i++) {
+         dropDocument.documentID = removedDocuments[i];
+         concordanceBST.setDeleteIf(dropDocument);
+      }
 
 
 // X-------------------------------X
 // |    Display the Concordance    |
 // X-------------------------------X
-      concordanceBST.printout();
+      // #SinkConsole - Receives each keyword matched by a query and sends it to cout
+      struct SinkConsole {
+         void operator()(LinkedListContext& someList) {
+            cout << someList;
+         }
+      } toConsole;
+      // A pattern is tested against the keywords alone, never the corpus: only those under its literal
+      // prefix are visited, in order. Each slice of them is tested across the hardware threads and its
+      // matches sent on (as records, or as text) while the traversal goes on, so output begins with the
+      // first slice. Keywords are pointed to where the lists hold them, never copied.
+      auto matchPattern = [&](bool asRecords) {
+         // #sliceLength - Keywords tested together: enough to be worth splitting across threads
+         const size_t sliceLength = 16384;
+         vector<const LinkedListContext*> sliceLists;
+         vector<const string*> sliceKeywords;
+         LinkedListContext::KeyKeyword keywordOf;
+         auto sendSlice = [&]() {
+            vector<char> isMatched = keywordPattern.matchAll(sliceKeywords);
+            for (unsigned int i = 0 ; i < sliceLists.size() ; i++) {
+               if (!isMatched[i]) {
+                  continue;
+               }
+               if (asRecords) {
+                  sliceLists[i]->writeRecords(recordWriter);
+               }
+               else {
+                  cout << *sliceLists[i];
+               }
+            }
+            sliceLists.clear();
+            sliceKeywords.clear();
+         };
+         auto toSlice = [&](const LinkedListContext& someList) {
+            sliceLists.push_back(&someList);
+            sliceKeywords.push_back(&keywordOf(someList));
+            if (sliceLists.size() == sliceLength) {
+               sendSlice();
+            }
+         };
+         concordanceBST.traversePrefix(keywordPattern.getLiteralPrefix(), toSlice);
+         sendSlice();
+      };
+      // Records are written by the same traversals as the text, through the writer
+      auto toRecords = [&recordWriter](const LinkedListContext& someList) {
+         someList.writeRecords(recordWriter);
+      };
+      // Displays the whole concordance, or only the keywords matched by the query
+      auto displayConcordance = [&]() {
+         if (outputFormat != 0) {
+            if (queryMode == 1) {
+               concordanceBST.traversePrefix(queryPrefix, toRecords);
+            }
+            else if (queryMode == 2) {
+               concordanceBST.traverseRange(queryLow, queryHigh, toRecords);
+            }
+            else if (queryMode == 3) {
+               concordanceBST.traversePage(pageOffset, pageCount, toRecords);
+            }
+            else if (queryMode == 4) {
+               matchPattern(true);
+            }
+            else {
+               concordanceBST.traversePage(0, -1, toRecords);
+            }
+            recordWriter.flush();
+         }
+         else if (queryMode == 1) {
+            concordanceBST.traversePrefix(queryPrefix, toConsole);
+            cout << endl;
+         }
+         else if (queryMode == 2) {
+            concordanceBST.traverseRange(queryLow, queryHigh, toConsole);
+            cout << endl;
+         }
+         else if (queryMode == 3 && renderThreads > 0) {
+            concordanceBST.printoutParallel(pageOffset, pageCount, renderThreads, renderOffsets ? 1 : -1);
+         }
+         else if (queryMode == 3) {
+            concordanceBST.printout(pageOffset, pageCount);
+         }
+         else if (queryMode == 4) {
+            matchPattern(false);
+            cout << endl;
+         }
+         else if (renderThreads > 0) {
+            concordanceBST.printoutParallel(0, -1, renderThreads, renderOffsets ? 1 : -1);
+         }
+         else {
+            concordanceBST.printout();
+         }
+      };
+      // Phrase queries are answered from the suffix index, in place of the concordance
+      if (!phraseQueries.empty()) {
+         LinkedListContext::setDocumentFilter(documentFilter);
+         for (unsigned int i = 0 ; i < phraseQueries.size() ; i++) {
+            displayPhrase(theIndex, theArchive, phraseQueries[i]);
+         }
+      }
+      // Collocation mode lists the strongest neighbours of each keyword the query matches, in place of its contexts
+      else if (collocateCount > 0) {
+         auto toCollocates = [&](const LinkedListContext& someList) {
+            if (queryMode == 4 && !keywordPattern.matches(someList.getKeyword())) {
+               return;
+            }
+            unsigned int wordID = theArchive.getWordID(someList.getPositions().getLastPosition());
+            vector<TallyCollocation::Collocate> rankedCollocates = collocationTallies[0].rank(wordID, collocateCount);
+            cout << someList.getKeyword() << "  " << collocationTallies[0].getOccurrenceCount(wordID) << " occurrences, "
+                 << collocationTallies[0].getPairTotal(wordID) << " neighbours within " << collocateSpan << endl;
+            size_t collocateWidth = 0;
+            for (unsigned int i = 0 ; i < rankedCollocates.size() ; i++) {
+               collocateWidth = max(collocateWidth, theArchive.getVocabularyWord(rankedCollocates[i].wordID).length());
+            }
+            for (unsigned int i = 0 ; i < rankedCollocates.size() ; i++) {
+               string collocateWord = theArchive.getVocabularyWord(rankedCollocates[i].wordID);
+               cout << "   " << collocateWord << string(collocateWidth - collocateWord.length() + 2, ' ') << rankedCollocates[i].count
+                    << "  G2 " << rankedCollocates[i].logLikelihood << "  PMI " << rankedCollocates[i].mutualInformation << endl;
+            }
+         };
+         ios::fmtflags savedFlags = cout.flags();
+         cout << fixed << setprecision(2);
+         if (queryMode == 2) {
+            concordanceBST.traverseRange(queryLow, queryHigh, toCollocates);
+         }
+         else {
+            concordanceBST.traversePrefix((queryMode == 4) ? keywordPattern.getLiteralPrefix() : queryPrefix, toCollocates);
+         }
+         cout.flags(savedFlags);
+         cout << endl;
+      }
+      // The radix tree lists its keywords in byte order, which is the BST's order for the cleaned keywords
+      else if (radixBuild) {
+         LinkedListContext::setDocumentFilter(documentFilter);
+         concordanceRadix.traversePrefix((queryMode == 1) ? queryPrefix : "", toConsole);
+         cout << endl;
+      }
+      else if (byDocument) {
+         for (unsigned int i = 0 ; i < documentAddresses.size() ; i++) {
+            cout << "Document " << i << ": " << documentAddresses[i] << endl;
+            LinkedListContext::setDocumentFilter(i);
+            displayConcordance();
+         }
+      }
+      else {
+         LinkedListContext::setDocumentFilter(documentFilter);
+         displayConcordance();
+      }
    }
 
 
-   cout << "This compiles and runs." << endl;
+   // Records written to standard output are left as the whole of it
+   if (outputFormat == 0 || outputAddress != "") {
+      cout << "This compiles and runs." << endl;
+   }
    cin.get();
    return(0);
 }
@@ -0,0 +1,327 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Field and method declarations for the HashTableGeneric class
+#include "HashTableGeneric.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------X
+// |    #slotOf(unsigned int)    |
+// X-----------------------------X
+// Fibonacci hashing: the top bits of someKey * 2^32 / golden ratio
+template <class typeT>
+unsigned int HashTableGeneric<typeT>::slotOf(unsigned int someKey) const {
+   return((someKey * 2654435769u) >> slotShift);
+}
+
+// X---------------X
+// |    #grow()    |
+// X---------------X
+// Doubles the slot array and re-seats every key by probing from its new home slot
+template <class typeT>
+void HashTableGeneric<typeT>::grow() {
+   vector<SlotHash> oldSlots;
+   oldSlots.swap(slotList);
+   SlotHash emptySlot = { emptyKey, 0 };
+   slotList.assign(oldSlots.size() * 2, emptySlot);
+   slotShift--;
+   unsigned int slotMask = slotList.size() - 1;
+   for (unsigned int i = 0 ; i < oldSlots.size() ; i++) {
+      if (oldSlots[i].slotKey == emptyKey) {
+         continue;
+      }
+      unsigned int slotIndex = slotOf(oldSlots[i].slotKey);
+      while (slotList[slotIndex].slotKey != emptyKey) {
+         slotIndex = (slotIndex + 1) & slotMask;
+      }
+      slotList[slotIndex] = oldSlots[i];
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------------X
+// |    #insert(unsigned int, typeD&&)    |
+// X--------------------------------------X
+// Probes from the home slot of someKey: a matching slot takes someData onto its entry, an empty one
+// records a new entry. The table doubles before it passes half full, keeping probe runs short.
+template <class typeT>
+template <class typeD>
+bool HashTableGeneric<typeT>::insert(unsigned int someKey, typeD&& someData) {
+   unsigned int slotMask = slotList.size() - 1;
+   unsigned int slotIndex = slotOf(someKey);
+   // Invariant: every slot probed so far holds another key
+   while (slotList[slotIndex].slotKey != emptyKey) {
+      if (slotList[slotIndex].slotKey == someKey) {
+         entryList[slotList[slotIndex].entryIndex] = std::forward<typeD>(someData);
+         return(false);
+      }
+      slotIndex = (slotIndex + 1) & slotMask;
+   }
+   // Not found: claim the empty slot
+   slotList[slotIndex].slotKey = someKey;
+   slotList[slotIndex].entryIndex = entryList.size();
+   entryList.push_back(std::forward<typeD>(someData));
+   if (entryList.size() * 2 > slotList.size()) {
+      grow();
+   }
+   return(true);
+}
+
+// X---------------------------X
+// |    #find(unsigned int)    |
+// X---------------------------X
+// Probes from the home slot of someKey until it or an empty slot turns up
+template <class typeT>
+typeT* HashTableGeneric<typeT>::find(unsigned int someKey) {
+   unsigned int slotMask = slotList.size() - 1;
+   unsigned int slotIndex = slotOf(someKey);
+   while (slotList[slotIndex].slotKey != emptyKey) {
+      if (slotList[slotIndex].slotKey == someKey) {
+         return(&entryList[slotList[slotIndex].entryIndex]);
+      }
+      slotIndex = (slotIndex + 1) & slotMask;
+   }
+   return(nullptr);
+}
+
+// X----------------X
+// |    #clear()    |
+// X----------------X
+// Empties every slot and drops the entries
+template <class typeT>
+void HashTableGeneric<typeT>::clear() {
+   SlotHash emptySlot = { emptyKey, 0 };
+   slotList.assign(slotList.size(), emptySlot);
+   entryList.clear();
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------X
+// |    #HashTableGeneric()    |
+// X---------------------------X
+// Default constructor. 1024 empty slots, 2^10, so slotShift is 32 - 10.
+template <class typeT>
+HashTableGeneric<typeT>::HashTableGeneric() {
+   SlotHash emptySlot = { emptyKey, 0 };
+   slotList.assign(1024, emptySlot);
+   slotShift = 32 - 10;
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------X
+// |    #getSize()    |
+// X------------------X
+// Returns the number of entries
+template <class typeT>
+int HashTableGeneric<typeT>::getSize() const {
+   return(entryList.size());
+}
+
+// X----------------X
+// |    #begin()    |
+// X----------------X
+// Returns an iterator to the first entry
+template <class typeT>
+typename vector<typeT>::iterator HashTableGeneric<typeT>::begin() {
+   return(entryList.begin());
+}
+
+// X--------------X
+// |    #end()    |
+// X--------------X
+// Returns an iterator one past the last entry
+template <class typeT>
+typename vector<typeT>::iterator HashTableGeneric<typeT>::end() {
+   return(entryList.end());
+}
@@ -0,0 +1,349 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for vector operations (slot array and entry storage)
+#include <vector>
+
+// Necessary for std::forward (insertion by rvalue)
+#include <utility>
+
+using namespace std;
+
+// X-------------------------X
+// |    #HashTableGeneric    |
+// X-------------------------X
+// Description: Generic open-addressing hash table keyed by an interned ID, ie. ArchiveCorpus::getWordID().
+//              Entries sit contiguously in insertion order; the slot array holds only (key, entry index)
+//              pairs, 8 bytes each, probed linearly. A lookup hashes one integer and usually touches
+//              one cache line, against a string comparison per level of a BSTGeneric descent.
+//              Unordered: bulk-load the entries into a BSTGeneric for sorted output.
+template <class typeT>
+class HashTableGeneric {
+
+protected:
+
+   // #SlotHash - One slot of the table: a key and the index of its entry
+   struct SlotHash {
+      unsigned int slotKey;
+      unsigned int entryIndex;
+   };
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------X
+// |    #emptyKey    |
+// X-----------------X
+// Key marking an unused slot. Never a valid interned ID.
+// Invariant information: 
+static const unsigned int emptyKey = 0xFFFFFFFF;
+
+// X-----------------X
+// |    #slotList    |
+// X-----------------X
+// The open-addressing slots.
+// Invariant information: Size is a power of two, at least twice entryList.size()
+vector<SlotHash> slotList;
+
+// X------------------X
+// |    #slotShift    |
+// X------------------X
+// Right shift that takes a 32-bit hash down to a slot index: 32 - log2(slotList.size()).
+// Invariant information: 
+int slotShift;
+
+// X------------------X
+// |    #entryList    |
+// X------------------X
+// The entries, in the order their keys were first inserted.
+// Invariant information: 
+vector<typeT> entryList;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------X
+// |    #slotOf(unsigned int)    |
+// X-----------------------------X
+// Description:      Returns the home slot of a key. Fibonacci hashing: multiply by 2^32 / golden ratio and
+//                   keep the top bits, so consecutive IDs spread across the table.
+// Parameters:       someKey - A key
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     0 to slotList.size() - 1
+// Functions called: None
+unsigned int slotOf(unsigned int someKey) const;
+
+// X---------------X
+// |    #grow()    |
+// X---------------X
+// Description:      Doubles the slot array and re-seats every key. Entries do not move.
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   slotList.size() has doubled
+// Return value:     None
+// Functions called: slotOf()
+void grow();
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------------X
+// |    #insert(unsigned int, typeD&&)    |
+// X--------------------------------------X
+// Description:      Adds someData under someKey, or assigns it onto the entry already there, as
+//                   BSTGeneric::insert() does. An rvalue is moved, an lvalue copied.
+// Parameters:       someKey - Interned ID, never emptyKey
+//                   someData - typeT to store
+// Preconditions:    None
+// Postconditions:   find(someKey) is not nullptr
+// Return value:     true if someKey was new
+// Functions called: slotOf(), grow(), std::forward()
+template <class typeD>
+bool insert(unsigned int someKey, typeD&& someData);
+
+// X---------------------------X
+// |    #find(unsigned int)    |
+// X---------------------------X
+// Description:      Looks up the entry of a key
+// Parameters:       someKey - Interned ID
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     The entry, or nullptr if someKey is absent. Invalidated by the next insert().
+// Functions called: slotOf()
+typeT* find(unsigned int someKey);
+
+// X----------------X
+// |    #clear()    |
+// X----------------X
+// Description:      Drops every entry, keeping the slot array's capacity
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   getSize() == 0
+// Return value:     None
+// Functions called: vector::clear()
+void clear();
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------X
+// |    #HashTableGeneric()    |
+// X---------------------------X
+// Default constructor. Makes an empty table with 1024 slots.
+HashTableGeneric();
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------X
+// |    #getSize()    |
+// X------------------X
+// Description:      Returns the number of entries
+// Return value:     >= 0
+int getSize() const;
+
+// X----------------X
+// |    #begin()    |
+// X----------------X
+// Description:      Returns an iterator to the first entry, in first-insertion order. With end(), the
+//                   range to hand BSTGeneric::bulkLoad() (through std::make_move_iterator to move them).
+// Return value:     A vector iterator
+typename vector<typeT>::iterator begin();
+
+// X--------------X
+// |    #end()    |
+// X--------------X
+// Description:      Returns an iterator one past the last entry
+// Return value:     A vector iterator
+typename vector<typeT>::iterator end();
+
+}; // Closing class HashTableGeneric
@@ -0,0 +1,646 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// IndexSuffix.h
+// IndexSuffix.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for string operations (the index file address)
+#include <string>
+
+// Necessary for vector operations (the arrays of a built index)
+#include <vector>
+
+// Necessary for writing the index file
+#include <fstream>
+
+// Necessary for sort(), fill() and copy() (the suffix sort and the positions found)
+#include <algorithm>
+
+// Necessary for memcmp() (the file header's tag)
+#include <cstring>
+
+// Necessary for mapping the index file (POSIX open(), fstat(), mmap(), munmap() and close())
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Field and method declarations for the IndexSuffix class
+#include "IndexSuffix.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------------------X
+// |    #sortSuffixes(vector<int>, int)    |
+// X---------------------------------------X
+// A suffix is S if it sorts before the suffix after it, L if after; the last is L. Within one symbol's
+// bucket the L suffixes sort before the S ones. Placing the LMS suffixes (S after L) at their buckets'
+// ends, one left-to-right pass induces every L suffix and one right-to-left pass every S suffix. That
+// sorts the LMS substrings; if two are equal, their order is settled by recursing on their names.
+vector<int> IndexSuffix::sortSuffixes(const vector<int>& someSequence, int someUpper) {
+   int sequenceLength = someSequence.size();
+   if (sequenceLength == 0) {
+      return(vector<int>());
+   }
+   if (sequenceLength == 1) {
+      return(vector<int>(1, 0));
+   }
+   if (sequenceLength == 2) {
+      return((someSequence[0] < someSequence[1]) ? vector<int>{0, 1} : vector<int>{1, 0});
+   }
+   vector<int> suffixOrder(sequenceLength);
+   // #isSType - Whether each suffix sorts before the one after it
+   vector<bool> isSType(sequenceLength, false);
+   for (int i = sequenceLength - 2 ; i >= 0 ; i--) {
+      isSType[i] = (someSequence[i] == someSequence[i + 1]) ? isSType[i + 1] : (someSequence[i] < someSequence[i + 1]);
+   }
+   // #bucketL, #bucketS - Where each symbol's L suffixes and S suffixes begin in suffixOrder
+   vector<int> bucketL(someUpper + 1, 0);
+   vector<int> bucketS(someUpper + 1, 0);
+   for (int i = 0 ; i < sequenceLength ; i++) {
+      if (!isSType[i]) {
+         bucketS[someSequence[i]]++;
+      }
+      else {
+         bucketL[someSequence[i] + 1]++;
+      }
+   }
+   for (int c = 0 ; c <= someUpper ; c++) {
+      bucketS[c] += bucketL[c];
+      if (c < someUpper) {
+         bucketL[c + 1] += bucketS[c];
+      }
+   }
+   // Seeds the LMS suffixes in the given order, then induces the L suffixes and the S suffixes from them
+   auto induceSort = [&](const vector<int>& someLms) {
+      fill(suffixOrder.begin(), suffixOrder.end(), -1);
+      vector<int> bucketNext(someUpper + 1);
+      copy(bucketS.begin(), bucketS.end(), bucketNext.begin());
+      for (unsigned int i = 0 ; i < someLms.size() ; i++) {
+         if (someLms[i] != sequenceLength) {
+            suffixOrder[bucketNext[someSequence[someLms[i]]]++] = someLms[i];
+         }
+      }
+      copy(bucketL.begin(), bucketL.end(), bucketNext.begin());
+      suffixOrder[bucketNext[someSequence[sequenceLength - 1]]++] = sequenceLength - 1;
+      for (int i = 0 ; i < sequenceLength ; i++) {
+         int thisSuffix = suffixOrder[i];
+         if (thisSuffix >= 1 && !isSType[thisSuffix - 1]) {
+            suffixOrder[bucketNext[someSequence[thisSuffix - 1]]++] = thisSuffix - 1;
+         }
+      }
+      copy(bucketL.begin(), bucketL.end(), bucketNext.begin());
+      for (int i = sequenceLength - 1 ; i >= 0 ; i--) {
+         int thisSuffix = suffixOrder[i];
+         if (thisSuffix >= 1 && isSType[thisSuffix - 1]) {
+            suffixOrder[--bucketNext[someSequence[thisSuffix - 1] + 1]] = thisSuffix - 1;
+         }
+      }
+   };
+   // #lmsIndex - Each LMS position's index among the LMS positions, or -1
+   vector<int> lmsIndex(sequenceLength + 1, -1);
+   vector<int> lmsPositions;
+   for (int i = 1 ; i < sequenceLength ; i++) {
+      if (!isSType[i - 1] && isSType[i]) {
+         lmsIndex[i] = lmsPositions.size();
+         lmsPositions.push_back(i);
+      }
+   }
+   int lmsCount = lmsPositions.size();
+   induceSort(lmsPositions);
+   if (lmsCount > 0) {
+      vector<int> sortedLms;
+      sortedLms.reserve(lmsCount);
+      for (int i = 0 ; i < sequenceLength ; i++) {
+         if (lmsIndex[suffixOrder[i]] != -1) {
+            sortedLms.push_back(suffixOrder[i]);
+         }
+      }
+      // Name each LMS substring by its rank among the distinct ones, in text order
+      vector<int> reducedSequence(lmsCount);
+      int reducedUpper = 0;
+      reducedSequence[lmsIndex[sortedLms[0]]] = 0;
+      for (int i = 1 ; i < lmsCount ; i++) {
+         int leftStart = sortedLms[i - 1];
+         int rightStart = sortedLms[i];
+         int leftEnd = (lmsIndex[leftStart] + 1 < lmsCount) ? lmsPositions[lmsIndex[leftStart] + 1] : sequenceLength;
+         int rightEnd = (lmsIndex[rightStart] + 1 < lmsCount) ? lmsPositions[lmsIndex[rightStart] + 1] : sequenceLength;
+         bool isSame = (leftEnd - leftStart == rightEnd - rightStart);
+         if (isSame) {
+            while (leftStart < leftEnd && someSequence[leftStart] == someSequence[rightStart]) {
+               leftStart++;
+               rightStart++;
+            }
+            if (leftStart == sequenceLength || someSequence[leftStart] != someSequence[rightStart]) {
+               isSame = false;
+            }
+         }
+         if (!isSame) {
+            reducedUpper++;
+         }
+         reducedSequence[lmsIndex[sortedLms[i]]] = reducedUpper;
+      }
+      vector<int> reducedOrder = sortSuffixes(reducedSequence, reducedUpper);
+      for (int i = 0 ; i < lmsCount ; i++) {
+         sortedLms[i] = lmsPositions[reducedOrder[i]];
+      }
+      induceSort(sortedLms);
+   }
+   return(suffixOrder);
+}
+
+// X--------------------------------------------X
+// |    #comparePhrase(unsigned int, vector)    |
+// X--------------------------------------------X
+// Compares word by word until the phrase or the tokens run out
+int IndexSuffix::comparePhrase(unsigned int somePosition, const vector<unsigned int>& somePhrase) const {
+   for (unsigned int i = 0 ; i < somePhrase.size() ; i++) {
+      if (somePosition + i >= tokenCount) {
+         return(-1);
+      }
+      if (tokenData[somePosition + i] != somePhrase[i]) {
+         return((tokenData[somePosition + i] < somePhrase[i]) ? -1 : 1);
+      }
+   }
+   return(0);
+}
+
+// X------------------X
+// |    #release()    |
+// X------------------X
+// Drops whichever storage the arrays point into
+void IndexSuffix::release() {
+   if (mappedBase != nullptr) {
+      munmap(mappedBase, mappedLength);
+   }
+   mappedBase = nullptr;
+   mappedLength = 0;
+   builtTokens.clear();
+   builtStarts.clear();
+   builtSuffixes.clear();
+   builtLcp.clear();
+   tokenData = nullptr;
+   startData = nullptr;
+   suffixData = nullptr;
+   lcpData = nullptr;
+   vocabularyOffsets = nullptr;
+   vocabularyOrder = nullptr;
+   vocabularyBytes = nullptr;
+   tokenCount = 0;
+   documentCount = 0;
+   vocabularyCount = 0;
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------X
+// |    #build(ArchiveCorpus)    |
+// X-----------------------------X
+// Copies the tokens out of the archive's chunks, sorts the suffixes, then computes the LCP array by
+// Kasai's method: the suffix at p + 1 shares at least one word fewer with its predecessor than the suffix
+// at p does, so the running match only ever drops by one between positions, O(n) in all
+void IndexSuffix::build(const ArchiveCorpus& someArchive) {
+   release();
+   tokenCount = someArchive.getTokenCount();
+   documentCount = someArchive.getDocumentCount();
+   builtTokens.resize(tokenCount);
+   vector<int> wordSequence(tokenCount);
+   for (unsigned int i = 0 ; i < tokenCount ; i++) {
+      builtTokens[i] = someArchive.getWordID(i);
+      wordSequence[i] = builtTokens[i];
+   }
+   for (unsigned int i = 0 ; i < documentCount ; i++) {
+      builtStarts.push_back(someArchive.getDocumentStart(i));
+   }
+   int vocabularyUpper = (someArchive.getVocabularySize() > 0) ? someArchive.getVocabularySize() - 1 : 0;
+   vector<int> suffixOrder = sortSuffixes(wordSequence, vocabularyUpper);
+   builtSuffixes.assign(suffixOrder.begin(), suffixOrder.end());
+   // #suffixRank - Where each position's suffix lies in the suffix array (reusing wordSequence's storage)
+   vector<int>& suffixRank = wordSequence;
+   for (unsigned int i = 0 ; i < tokenCount ; i++) {
+      suffixRank[builtSuffixes[i]] = i;
+   }
+   builtLcp.assign(tokenCount, 0);
+   unsigned int matchLength = 0;
+   for (unsigned int position = 0 ; position < tokenCount ; position++) {
+      if (matchLength > 0) {
+         matchLength--;
+      }
+      if (suffixRank[position] == 0) {
+         matchLength = 0;
+         continue;
+      }
+      unsigned int otherPosition = builtSuffixes[suffixRank[position] - 1];
+      while (position + matchLength < tokenCount && otherPosition + matchLength < tokenCount
+             && builtTokens[position + matchLength] == builtTokens[otherPosition + matchLength]) {
+         matchLength++;
+      }
+      builtLcp[suffixRank[position]] = matchLength;
+   }
+   tokenData = builtTokens.data();
+   startData = builtStarts.data();
+   suffixData = builtSuffixes.data();
+   lcpData = builtLcp.data();
+}
+
+// X------------------------------------X
+// |    #save(string, ArchiveCorpus)    |
+// X------------------------------------X
+// Lays the file out so that every array starts on a 4-byte boundary and can be used in place once mapped
+bool IndexSuffix::save(const string& someAddress, const ArchiveCorpus& someArchive) const {
+   ofstream indexFile(someAddress.c_str(), ios::binary | ios::trunc);
+   if (!indexFile.is_open()) {
+      return(false);
+   }
+   vector<unsigned int> wordOffsets;
+   vector<string> wordList(someArchive.getVocabularySize());
+   string wordBytes;
+   for (unsigned int i = 0 ; i < someArchive.getVocabularySize() ; i++) {
+      wordOffsets.push_back(wordBytes.size());
+      wordList[i] = someArchive.getVocabularyWord(i);
+      wordBytes += wordList[i];
+      wordBytes += '\0';
+   }
+   wordOffsets.push_back(wordBytes.size());
+   // #wordOrder - Word IDs in the byte order of their words, so an opened index finds a word by binary search
+   vector<unsigned int> wordOrder(wordList.size());
+   for (unsigned int i = 0 ; i < wordOrder.size() ; i++) {
+      wordOrder[i] = i;
+   }
+   sort(wordOrder.begin(), wordOrder.end(), [&wordList](unsigned int leftID, unsigned int rightID) {
+      return(wordList[leftID] < wordList[rightID]);
+   });
+   unsigned int headerCounts[4] = { tokenCount, documentCount, (unsigned int)wordOffsets.size() - 1, (unsigned int)wordBytes.size() };
+   indexFile.write("SUFFIXv2", 8);
+   indexFile.write((const char*)headerCounts, sizeof(headerCounts));
+   indexFile.write((const char*)tokenData, (size_t)tokenCount * sizeof(unsigned int));
+   indexFile.write((const char*)startData, (size_t)documentCount * sizeof(unsigned int));
+   indexFile.write((const char*)suffixData, (size_t)tokenCount * sizeof(unsigned int));
+   indexFile.write((const char*)lcpData, (size_t)tokenCount * sizeof(unsigned int));
+   indexFile.write((const char*)wordOffsets.data(), wordOffsets.size() * sizeof(unsigned int));
+   indexFile.write((const char*)wordOrder.data(), wordOrder.size() * sizeof(unsigned int));
+   indexFile.write(wordBytes.data(), wordBytes.size());
+   return(!indexFile.fail());
+}
+
+// X---------------------X
+// |    #open(string)    |
+// X---------------------X
+// Maps the whole file read-only and points the arrays into it. The header, the document starts and the
+// vocabulary are checked, O(documents + words), so that no later read can leave the mapping; the tokens
+// and suffixes are not read until a query touches them, and are bounds-checked where they are read.
+bool IndexSuffix::open(const string& someAddress) {
+   release();
+   int fileDescriptor = ::open(someAddress.c_str(), O_RDONLY);
+   if (fileDescriptor < 0) {
+      return(false);
+   }
+   struct stat fileStatus;
+   if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size < 24) {
+      close(fileDescriptor);
+      return(false);
+   }
+   void* fileBase = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+   close(fileDescriptor);
+   if (fileBase == MAP_FAILED) {
+      return(false);
+   }
+   mappedBase = fileBase;
+   mappedLength = fileStatus.st_size;
+   const char* fileBytes = (const char*)fileBase;
+   const unsigned int* headerCounts = (const unsigned int*)(fileBytes + 8);
+   unsigned long long expectedLength = 24 + 4ULL * (3ULL * headerCounts[0] + headerCounts[1] + 2ULL * headerCounts[2] + 1) + headerCounts[3];
+   if (memcmp(fileBytes, "SUFFIXv2", 8) != 0 || expectedLength != mappedLength) {
+      release();
+      return(false);
+   }
+   tokenCount = headerCounts[0];
+   documentCount = headerCounts[1];
+   vocabularyCount = headerCounts[2];
+   tokenData = headerCounts + 4;
+   startData = tokenData + tokenCount;
+   suffixData = startData + documentCount;
+   lcpData = suffixData + tokenCount;
+   vocabularyOffsets = lcpData + tokenCount;
+   vocabularyOrder = vocabularyOffsets + vocabularyCount + 1;
+   vocabularyBytes = (const char*)(vocabularyOrder + vocabularyCount);
+   unsigned int byteCount = headerCounts[3];
+   // Every position lies in a document, the first starting at 0, and the starts ascend to at most tokenCount
+   bool isValid = (tokenCount == 0 || (documentCount > 0 && startData[0] == 0));
+   for (unsigned int i = 0 ; isValid && i < documentCount ; i++) {
+      isValid = (startData[i] <= tokenCount && (i == 0 || startData[i - 1] <= startData[i]));
+   }
+   // Each word ends in a NUL just before the next word's offset, and the last ends at the end of the bytes
+   isValid = isValid && vocabularyOffsets[0] == 0 && vocabularyOffsets[vocabularyCount] == byteCount;
+   for (unsigned int i = 0 ; isValid && i < vocabularyCount ; i++) {
+      isValid = (vocabularyOffsets[i] < vocabularyOffsets[i + 1] && vocabularyOffsets[i + 1] <= byteCount
+                 && vocabularyBytes[vocabularyOffsets[i + 1] - 1] == '\0' && vocabularyOrder[i] < vocabularyCount);
+   }
+   if (!isValid) {
+      release();
+      return(false);
+   }
+   return(true);
+}
+
+// X-------------------------------------X
+// |    #attachArchive(ArchiveCorpus)    |
+// X-------------------------------------X
+// The archive reads the mapping in place, so attaching it copies nothing
+bool IndexSuffix::attachArchive(ArchiveCorpus& someArchive) const {
+   if (vocabularyOffsets == nullptr) {
+      return(false);
+   }
+   return(someArchive.attachView(tokenData, tokenCount, startData, documentCount, vocabularyOffsets, vocabularyBytes, vocabularyOrder, vocabularyCount));
+}
+
+// X---------------------X
+// |    #find(vector)    |
+// X---------------------X
+// Binary search for the first suffix not sorting before the phrase, then a walk along the LCP array for
+// the rest of the range. An occurrence running past the end of its document is dropped.
+vector<unsigned int> IndexSuffix::find(const vector<unsigned int>& somePhrase) const {
+   vector<unsigned int> retPositions;
+   if (somePhrase.empty() || tokenCount == 0) {
+      return(retPositions);
+   }
+   // Invariant: every suffix before lowIndex sorts before the phrase, and none from highIndex on does
+   unsigned int lowIndex = 0;
+   unsigned int highIndex = tokenCount;
+   while (lowIndex < highIndex) {
+      unsigned int middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+      if (comparePhrase(suffixData[middleIndex], somePhrase) < 0) {
+         lowIndex = middleIndex + 1;
+      }
+      else {
+         highIndex = middleIndex;
+      }
+   }
+   if (lowIndex == tokenCount || comparePhrase(suffixData[lowIndex], somePhrase) != 0) {
+      return(retPositions);
+   }
+   unsigned int rangeEnd = lowIndex + 1;
+   while (rangeEnd < tokenCount && lcpData[rangeEnd] >= somePhrase.size()) {
+      rangeEnd++;
+   }
+   for (unsigned int i = lowIndex ; i < rangeEnd ; i++) {
+      unsigned int thisPosition = suffixData[i];
+      // A suffix entry past the tokens can only come from a corrupt file
+      if (thisPosition >= tokenCount) {
+         continue;
+      }
+      // The document holding thisPosition is the last to start at or before it
+      unsigned int nextDocument = upper_bound(startData, startData + documentCount, thisPosition) - startData;
+      unsigned int documentEnd = (nextDocument < documentCount) ? startData[nextDocument] : tokenCount;
+      if (thisPosition + somePhrase.size() <= documentEnd) {
+         retPositions.push_back(thisPosition);
+      }
+   }
+   sort(retPositions.begin(), retPositions.end());
+   return(retPositions);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------X
+// |    #IndexSuffix()    |
+// X----------------------X
+// Nothing is built or mapped until build() or open()
+IndexSuffix::IndexSuffix() {
+   mappedBase = nullptr;
+   release();
+}
+
+// X-----------------------X
+// |    #~IndexSuffix()    |
+// X-----------------------X
+// Unmaps the index file, if one is mapped
+IndexSuffix::~IndexSuffix() {
+   release();
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #getTokenCount()    |
+// X------------------------X
+// Returns the positions indexed
+unsigned int IndexSuffix::getTokenCount() const {
+   return(tokenCount);
+}
+
+// X---------------------------X
+// |    #getDocumentCount()    |
+// X---------------------------X
+// Returns the documents indexed
+unsigned int IndexSuffix::getDocumentCount() const {
+   return(documentCount);
+}
+
+// X-------------------X
+// |    #isMapped()    |
+// X-------------------X
+// Returns whether the index is mapped from a file rather than built
+bool IndexSuffix::isMapped() const {
+   return(mappedBase != nullptr);
+}
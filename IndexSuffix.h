@@ -0,0 +1,431 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// IndexSuffix.h
+// IndexSuffix.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for string operations (the index file address)
+#include <string>
+
+// Necessary for vector operations (the arrays of a built index, and the positions a query finds)
+#include <vector>
+
+// The token store the index is built from, and restored into when loaded
+#include "ArchiveCorpus.h"
+
+using namespace std;
+
+// X--------------------X
+// |    #IndexSuffix    |
+// X--------------------X
+// Description: A suffix array over the archive's word IDs, with its LCP array, answering any phrase query
+//              without a rebuild. The suffix array lists every token position in the order of the word
+//              sequences starting there, so the positions starting a phrase form one contiguous range: its
+//              start is found by binary search, O(m log n) for an m-word phrase, and the range runs on while
+//              the LCP array (the words each suffix shares with the one before it) stays at m or more.
+//              Both arrays are built in O(n) time, by SA-IS (Nong, Zhang & Chan, 2009) and Kasai et al.'s
+//              algorithm (2001). An index can be saved with the archive it covers (-saveindex), and a saved
+//              one is memory-mapped when opened (-index): the arrays are used where they lie in the file,
+//              so opening costs no parse and no sort, and pages are only read as queries touch them.
+//              Not copyable.
+class IndexSuffix {
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------X
+// |    #builtTokens    |
+// X--------------------X
+// Description: The built index's own arrays. Empty when the index is mapped from a file.
+// Invariants:  builtSuffixes and builtLcp are the same length as builtTokens
+vector<unsigned int> builtTokens;
+vector<unsigned int> builtStarts;
+vector<unsigned int> builtSuffixes;
+vector<unsigned int> builtLcp;
+
+// X-------------------X
+// |    #mappedBase    |
+// X-------------------X
+// Description: The mapped index file, and its length in bytes
+// Invariants:  nullptr and 0 unless the index was opened from a file
+void* mappedBase;
+size_t mappedLength;
+
+// X------------------X
+// |    #tokenData    |
+// X------------------X
+// Description: The arrays queries run on, in the built vectors or in the mapped file: the word ID at each
+//              position, the first position of each document, the suffix array, and the LCP array, where
+//              lcpData[i] is the words shared by the suffixes at suffixData[i - 1] and suffixData[i]
+// Invariants:  tokenCount entries in tokenData, suffixData and lcpData, and documentCount in startData.
+//              lcpData[0] is 0.
+const unsigned int* tokenData;
+const unsigned int* startData;
+const unsigned int* suffixData;
+const unsigned int* lcpData;
+unsigned int tokenCount;
+unsigned int documentCount;
+
+// X--------------------------X
+// |    #vocabularyOffsets    |
+// X--------------------------X
+// Description: A mapped index's vocabulary: word i is the bytes from vocabularyBytes + vocabularyOffsets[i]
+//              up to the NUL before offset i + 1. vocabularyOrder lists the word IDs in the byte order of
+//              their words. A built index renders through its archive, and holds none.
+// Invariants:  vocabularyCount + 1 ascending offsets, the last being the byte count, when mapped; nullptr
+//              when built
+const unsigned int* vocabularyOffsets;
+const unsigned int* vocabularyOrder;
+const char* vocabularyBytes;
+unsigned int vocabularyCount;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------------------X
+// |    #sortSuffixes(vector<int>, int)    |
+// X---------------------------------------X
+// Description:      Suffix array of a sequence by SA-IS. The suffixes are classed S or L by whether each
+//                   sorts before or after the one following it, the leftmost S suffixes of each run (LMS)
+//                   are sorted by inducing from bucket ends, and any LMS substrings found equal are named
+//                   and sorted by the same method on the shorter sequence of names.
+// Parameters:       someSequence - Symbols 0 to someUpper
+//                   someUpper - The largest symbol
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     The start positions of the suffixes of someSequence, in sorted order. A suffix that is
+//                   a prefix of another sorts first.
+// Functions called: sortSuffixes() recursively
+static vector<int> sortSuffixes(const vector<int>& someSequence, int someUpper);
+
+// X--------------------------------------------X
+// |    #comparePhrase(unsigned int, vector)    |
+// X--------------------------------------------X
+// Description:      Compares the words starting at a position with a phrase
+// Parameters:       somePosition - A token position
+//                   somePhrase - Word IDs
+// Preconditions:    somePosition < tokenCount
+// Postconditions:   None
+// Return value:     Negative, 0 or positive as the words from somePosition sort before, start with, or
+//                   sort after somePhrase. Running out of tokens first sorts before.
+// Functions called: None
+int comparePhrase(unsigned int somePosition, const vector<unsigned int>& somePhrase) const;
+
+// X------------------X
+// |    #release()    |
+// X------------------X
+// Description:      Unmaps the file and empties the arrays
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   tokenCount is 0 and nothing is mapped
+// Return value:     None
+// Functions called: munmap()
+void release();
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------X
+// |    #build(ArchiveCorpus)    |
+// X-----------------------------X
+// Description:      Indexes every position of an archive, replacing any index held
+// Parameters:       someArchive - The archive, holding every token read since its first document
+// Preconditions:    someArchive has not discarded any tokens (-window)
+// Postconditions:   find() answers over someArchive's positions
+// Return value:     None
+// Functions called: sortSuffixes()
+void build(const ArchiveCorpus& someArchive);
+
+// X------------------------------------X
+// |    #save(string, ArchiveCorpus)    |
+// X------------------------------------X
+// Description:      Writes the index, with the archive's words, tokens and documents, to one binary file:
+//                   a 24-byte header ("SUFFIXv2", then the token, document and word counts and the bytes
+//                   of vocabulary text), then the tokens, document starts, suffix array, LCP array, word
+//                   offsets and word IDs in word order as native 32-bit integers, then the words, each
+//                   NUL-terminated
+// Parameters:       someAddress - File to write
+//                   someArchive - The archive the index was built from
+// Preconditions:    build() was given someArchive, and it has not changed since
+// Postconditions:   open() restores this index
+// Return value:     false if the file cannot be written
+// Functions called: ofstream::write()
+bool save(const string& someAddress, const ArchiveCorpus& someArchive) const;
+
+// X---------------------X
+// |    #open(string)    |
+// X---------------------X
+// Description:      Maps an index written by save(), replacing any index held
+// Parameters:       someAddress - File to map
+// Preconditions:    None
+// Postconditions:   find() answers over the saved positions. The file stays mapped until this index
+//                   is destroyed or replaced.
+// Return value:     false if the file cannot be mapped, its header does not match its length, or its
+//                   document starts or vocabulary are out of order or out of bounds
+// Functions called: open(), fstat(), mmap()
+bool open(const string& someAddress);
+
+// X-------------------------------------X
+// |    #attachArchive(ArchiveCorpus)    |
+// X-------------------------------------X
+// Description:      Makes an empty archive a read-only view of a mapped index's words, tokens and documents,
+//                   so that the occurrences found can be rendered. O(1): nothing is copied or interned.
+// Parameters:       someArchive - An empty archive
+// Preconditions:    The index was opened from a file, and outlives someArchive
+// Postconditions:   Positions and word IDs in someArchive match the index's
+// Return value:     false if the index was built rather than opened, or someArchive is not empty
+// Functions called: ArchiveCorpus::attachView()
+bool attachArchive(ArchiveCorpus& someArchive) const;
+
+// X---------------------X
+// |    #find(vector)    |
+// X---------------------X
+// Description:      Finds every occurrence of a phrase lying within one document
+// Parameters:       somePhrase - The phrase's word IDs, at least one
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     The token positions the phrase starts at, ascending
+// Functions called: comparePhrase()
+vector<unsigned int> find(const vector<unsigned int>& somePhrase) const;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------X
+// |    #IndexSuffix()    |
+// X----------------------X
+// Description:      Creates an empty index. build() or open() fills it.
+IndexSuffix();
+
+// X-----------------------X
+// |    #~IndexSuffix()    |
+// X-----------------------X
+// Description:      Unmaps the index file, if one is mapped
+~IndexSuffix();
+
+IndexSuffix(const IndexSuffix&) = delete;
+IndexSuffix& operator=(const IndexSuffix&) = delete;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #getTokenCount()    |
+// X------------------------X
+// Description:      Returns the positions indexed
+unsigned int getTokenCount() const;
+
+// X---------------------------X
+// |    #getDocumentCount()    |
+// X---------------------------X
+// Description:      Returns the documents indexed
+unsigned int getDocumentCount() const;
+
+// X-------------------X
+// |    #isMapped()    |
+// X-------------------X
+// Description:      Returns whether the index is mapped from a file rather than built
+bool isMapped() const;
+
+}; // Closing class IndexSuffix
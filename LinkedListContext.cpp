@@ -162,8 +162,20 @@
 // Necessary for string operations
 #include <string>
 
+// Necessary for vector operations (decoding a capped list's sample to resample it)
+#include <vector>
+
+// Necessary for hash table operations (grouping the occurrences that share a window)
+#include <unordered_map>
+
+// Necessary for nth_element() and max_element() (the capped sample)
+#include <algorithm>
+
 #include "LinkedListContext.h"
-// #include "NodeContext.cpp"
+
+// Append-only storage for the n-gram keywords
+#include "VectorChunked.h"
+#include "VectorChunked.cpp" // .cpp required here due to generic/template functionality of this class
 
 using namespace std;
 
@@ -181,14 +193,71 @@ using namespace std;
 // X-----------------X
 // Description: 
 // Invariants:  
-int LinkedListContext::formatLength;
+atomic<int> LinkedListContext::formatLength;
 
 // X-----------------X
 // |    #NAME    |
 // X-----------------X
 // Description: 
 // Invariants:  
-int LinkedListContext::keywordFormatLength;
+atomic<int> LinkedListContext::keywordFormatLength;
+
+// X------------------------X
+// |    #documentFilter    |
+// X------------------------X
+// Description: Document whose occurrences toString() emits
+// Invariants:  -1 emits every document
+int LinkedListContext::documentFilter = -1;
+
+// X-------------------X
+// |    #archivePtr    |
+// X-------------------X
+// Description: Token store that every occurrence position refers to
+// Invariants:  Set by the driver before output
+const ArchiveCorpus* LinkedListContext::archivePtr = nullptr;
+
+// X----------------------X
+// |    #occurrenceCap    |
+// X----------------------X
+// Description: Most occurrences a list holds before it samples
+// Invariants:  0 holds every occurrence
+unsigned int LinkedListContext::occurrenceCap = 0;
+
+// X-------------------X
+// |    #sampleSeed    |
+// X-------------------X
+// Description: Seed of every capped list's sampling
+// Invariants:  None
+unsigned long long LinkedListContext::sampleSeed = 0;
+
+// X------------------------X
+// |    #collapseRepeats    |
+// X------------------------X
+// Description: Render a repeated window once, with its multiplicity
+// Invariants:  None
+bool LinkedListContext::collapseRepeats = false;
+
+// X---------------------X
+// |    #phraseLength    |
+// X---------------------X
+// Description: Words in every keyword
+// Invariants:  At least 1
+unsigned int LinkedListContext::phraseLength = 1;
+
+// X---------------------X
+// |    #isWidthFixed    |
+// X---------------------X
+// Description: Widths set up front, never widened
+// Invariants:  None
+bool LinkedListContext::isWidthFixed = false;
+
+// X-----------------------X
+// |    #phraseKeywords    |
+// X-----------------------X
+// Description: Keywords the archive does not hold, and their reverse lookup
+// Invariants:  No keyword appears twice
+VectorChunked<string> LinkedListContext::phraseKeywords;
+unordered_map<string, unsigned int> LinkedListContext::phraseIndex;
 
 // Do not reinitialize these variables in the .cpp.
 // Included here for reference
@@ -198,14 +267,7 @@ int LinkedListContext::keywordFormatLength;
 // X-----------------X
 // Description: 
 // Invariants:  
-// NodeContext* currPtr;
-
-// X-----------------X
-// |    #NAME    |
-// X-----------------X
-// Description: 
-// Invariants:  
-// NodeContext* headNodePtr;
+// ListPostings occurrencePositions;
 
 // X-----------------X
 // |    #NAME    |
@@ -214,13 +276,6 @@ int LinkedListContext::keywordFormatLength;
 // Invariants:  
 // string keyword;
 
-// X-----------------X
-// |    #NAME    |
-// X-----------------X
-// Description: 
-// Invariants:  
-// int longestPrev;
-
 
 
 //-------|---------|---------|---------|---------|---------|---------|---------|
@@ -229,83 +284,201 @@ int LinkedListContext::keywordFormatLength;
 //
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
-// X------------------X
-// |    #advance()    |
-// X------------------X
-// If currPtr is not the last node, moves currPtr forward one body node per call.
-void LinkedListContext::advance() {
-   if (isLastNode() == false) {
-      currPtr = currPtr->nextPtr;
+// X----------------------X
+// |    #keywordText()    |
+// X----------------------X
+// Reads the keyword through its ID. Both stores are chunked, so the reference survives their growth.
+const string& LinkedListContext::keywordText() const {
+   static const string noText = "";
+   if (keywordID == noKeyword) {
+      return(noText);
    }
-   else {
-      cout << "Error: Cannot advance. This is the last node." << endl;
+   if ((keywordID & phraseFlag) != 0) {
+      return(phraseKeywords[keywordID & ~phraseFlag]);
    }
+   return(archivePtr->getVocabularyEntry(keywordID));
 }
 
-// X-------------------------------X
-// |    #append(string, string)    |
-// X-------------------------------X
-// Adds a new node to the Linked List using the provided contexts and updates the maximum prev context length
-void LinkedListContext::append(string prevContext, string postContext){
-   // cout << "LLC.append() called." << endl; // DEBUG
-   this->reset();
-   if (this->headNodePtr == nullptr) {
-      // cout << "No head node" << endl; // DEBUG
-      this->headNodePtr = new NodeContext(prevContext, postContext);
-      this->currPtr = this->headNodePtr;
-      // cout << "Append completed on a blank LLC." << endl; // DEBUG
+// X--------------------------------------------X
+// |    #internKeyword(string, unsigned int)    |
+// X--------------------------------------------X
+// Every single-word keyword is the word archived at its position, so one compare finds its word ID. A mapped
+// archive holds no strings to refer to, so its keywords are interned as phrases are.
+unsigned int LinkedListContext::internKeyword(const string& someKeyword, unsigned int somePosition) {
+   if (archivePtr != nullptr && !archivePtr->isView() && somePosition < archivePtr->getTokenCount()) {
+      unsigned int wordID = archivePtr->getWordID(somePosition);
+      if (archivePtr->getVocabularyEntry(wordID) == someKeyword) {
+         return(wordID);
+      }
+   }
+   unordered_map<string, unsigned int>::iterator foundPhrase = phraseIndex.find(someKeyword);
+   if (foundPhrase != phraseIndex.end()) {
+      return(foundPhrase->second);
+   }
+   unsigned int phraseID = phraseFlag | (unsigned int)phraseKeywords.size();
+   phraseKeywords.push_back(someKeyword);
+   phraseIndex[someKeyword] = phraseID;
+   return(phraseID);
+}
+
+// X----------------------------------------------X
+// |    #appendRun(unsigned int, unsigned int)    |
+// X----------------------------------------------X
+// Records that the occurrences from index someFirstIndex on belong to someDocumentID, extending the final run when possible
+void LinkedListContext::appendRun(unsigned int someDocumentID, unsigned int someFirstIndex) {
+   // Same document as the final run: it already reaches to the last occurrence, so it grows by itself
+   if (runDocuments.getCount() > 0 && someDocumentID == runDocuments.getLastPosition()) {
       return;
    }
-   // Move to the end of the linked list
-   while (!this->isLastNode()) {
-      this->advance();
-   } // currPtr now points at the last node
-   // Append a new node with the provided contexts
-   this->currPtr->nextPtr = new NodeContext(prevContext, postContext);
-   // Set an updated formatLength
-   if ((signed)prevContext.length() > formatLength) {
-      formatLength = prevContext.length();
+   // Otherwise open a new run
+   runDocuments.append(someDocumentID);
+   runStarts.append(someFirstIndex);
+}
+
+// X-----------------------------------------------------X
+// |    #decodeOccurrences(vector<unsigned int>, ...)    |
+// X-----------------------------------------------------X
+// Unpacks the positions, decoding the runs alongside as toString() does
+void LinkedListContext::decodeOccurrences(vector<unsigned int>& somePositions, vector<unsigned int>& someDocuments) const {
+   unsigned int occurrenceCount = occurrencePositions.getCount();
+   somePositions.reserve(occurrenceCount);
+   someDocuments.reserve(occurrenceCount);
+   ListPostings::Cursor documentCursor(runDocuments);
+   ListPostings::Cursor startCursor(runStarts);
+   unsigned int nextRunStart = startCursor.hasNext() ? startCursor.next() : occurrenceCount;
+   unsigned int documentID = 0;
+   ListPostings::Cursor positionCursor(occurrencePositions);
+   for (unsigned int i = 0 ; positionCursor.hasNext() ; i++) {
+      if (i == nextRunStart) {
+         documentID = documentCursor.next();
+         nextRunStart = startCursor.hasNext() ? startCursor.next() : occurrenceCount;
+      }
+      somePositions.push_back(positionCursor.next());
+      someDocuments.push_back(documentID);
    }
-} // End append
+}
 
-// #isLastNode() - Reports whether the currPtr points to the last body node.
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-bool LinkedListContext::isLastNode() {
-   // Test to avoid read access error, currPtr might be null, in which case nextPtr cannot be read
-//   if (currPtr == nullptr) {
-//      return(true);
-//   }
-   // If the nextPtr is off the end of the linked list...
-   if (currPtr->nextPtr == nullptr) {
-      // This is the last node
-      return(true);
+// X------------------------------------------------------X
+// |    #rebuildOccurrences(vector<unsigned int>, ...)    |
+// X------------------------------------------------------X
+// Re-encodes the postings and runs from scratch. A capped list is short, so this costs O(occurrenceCap).
+void LinkedListContext::rebuildOccurrences(const vector<unsigned int>& somePositions, const vector<unsigned int>& someDocuments) {
+   ListPostings emptyPositions;
+   ListPostings emptyDocuments;
+   ListPostings emptyStarts;
+   std::swap(occurrencePositions, emptyPositions);
+   std::swap(runDocuments, emptyDocuments);
+   std::swap(runStarts, emptyStarts);
+   for (unsigned int i = 0 ; i < somePositions.size() ; i++) {
+      appendRun(someDocuments[i], i);
+      occurrencePositions.append(somePositions[i]);
    }
-   // Otherwise, it isn't.
-   return(false);
 }
 
-// X----------------X
-// |    #reset()    |
-// X----------------X
-// #reset() - Sets the current node pointer to the head node
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-void LinkedListContext::reset() {
-   if (headNodePtr != nullptr) {
-      currPtr = headNodePtr; // TODO - Confirm this assignment works
+// X----------------------------------------------------X
+// |    #offerOccurrence(unsigned int, unsigned int)    |
+// X----------------------------------------------------X
+// An occurrence ranked above sampleBound cannot displace a held one and is turned away without decoding;
+// past the first few multiples of occurrenceCap that is nearly every one. Dropping the displaced one and
+// appending the newcomer keeps the postings in corpus order.
+void LinkedListContext::offerOccurrence(unsigned int somePosition, unsigned int someDocumentID) {
+   occurrenceTotal++;
+   unsigned long long thisRank = sampleRank(somePosition);
+   unsigned int heldCount = occurrencePositions.getCount();
+   if (heldCount < occurrenceCap) {
+      appendRun(someDocumentID, heldCount);
+      occurrencePositions.append(somePosition);
+      sampleBound = max(sampleBound, (unsigned int)(thisRank >> 32));
+      return;
+   }
+   if ((unsigned int)(thisRank >> 32) > sampleBound) {
+      return;
+   }
+   vector<unsigned int> keptPositions;
+   vector<unsigned int> keptDocuments;
+   decodeOccurrences(keptPositions, keptDocuments);
+   vector<unsigned long long> keptRanks(keptPositions.size());
+   unsigned int replacedIndex = 0;
+   for (unsigned int i = 0 ; i < keptPositions.size() ; i++) {
+      keptRanks[i] = sampleRank(keptPositions[i]);
+      if (keptRanks[i] > keptRanks[replacedIndex]) {
+         replacedIndex = i;
+      }
+   }
+   if (thisRank >= keptRanks[replacedIndex]) {
+      return;
+   }
+   keptRanks.erase(keptRanks.begin() + replacedIndex);
+   keptRanks.push_back(thisRank);
+   sampleBound = (unsigned int)(*max_element(keptRanks.begin(), keptRanks.end()) >> 32);
+   // Within a single document the runs stay as they are, and the postings drop the one position in place
+   if (runDocuments.getCount() == 1 && someDocumentID == runDocuments.getLastPosition()) {
+      occurrencePositions.removeAt(replacedIndex);
+      occurrencePositions.append(somePosition);
+      return;
+   }
+   keptPositions.erase(keptPositions.begin() + replacedIndex);
+   keptDocuments.erase(keptDocuments.begin() + replacedIndex);
+   keptPositions.push_back(somePosition);
+   keptDocuments.push_back(someDocumentID);
+   rebuildOccurrences(keptPositions, keptDocuments);
+}
+
+// X----------------------------------------X
+// |    #mergeSample(LinkedListContext&)    |
+// X----------------------------------------X
+// Each list already holds the least-ranked of its own occurrences, so the least-ranked of their union are
+// among the ones held. The result depends on the ranks alone, not on where one batch ended and the next began.
+void LinkedListContext::mergeSample(const LinkedListContext& someLinkedList) {
+   vector<unsigned int> heldPositions;
+   vector<unsigned int> heldDocuments;
+   vector<unsigned int> addedPositions;
+   vector<unsigned int> addedDocuments;
+   decodeOccurrences(heldPositions, heldDocuments);
+   someLinkedList.decodeOccurrences(addedPositions, addedDocuments);
+   heldPositions.insert(heldPositions.end(), addedPositions.begin(), addedPositions.end());
+   heldDocuments.insert(heldDocuments.end(), addedDocuments.begin(), addedDocuments.end());
+   vector<unsigned long long> heldRanks(heldPositions.size());
+   for (unsigned int i = 0 ; i < heldPositions.size() ; i++) {
+      heldRanks[i] = sampleRank(heldPositions[i]);
+   }
+   // #rankCutoff - Rank of the occurrenceCap-th least-ranked occurrence, the greatest one kept
+   unsigned long long rankCutoff = ~0ULL;
+   if (heldRanks.size() > occurrenceCap) {
+      vector<unsigned long long> sortedRanks(heldRanks);
+      nth_element(sortedRanks.begin(), sortedRanks.begin() + (occurrenceCap - 1), sortedRanks.end());
+      rankCutoff = sortedRanks[occurrenceCap - 1];
+   }
+   vector<unsigned int> mergedPositions;
+   vector<unsigned int> mergedDocuments;
+   sampleBound = 0;
+   for (unsigned int i = 0 ; i < heldPositions.size() && mergedPositions.size() < occurrenceCap ; i++) {
+      if (heldRanks[i] <= rankCutoff) {
+         mergedPositions.push_back(heldPositions[i]);
+         mergedDocuments.push_back(heldDocuments[i]);
+         sampleBound = max(sampleBound, (unsigned int)(heldRanks[i] >> 32));
+      }
    }
+   rebuildOccurrences(mergedPositions, mergedDocuments);
+   occurrenceTotal = occurrenceTotal + someLinkedList.occurrenceTotal;
+}
+
+// X---------------------------------X
+// |    #sampleRank(unsigned int)    |
+// X---------------------------------X
+// Mixed twice, so that the seed and the position do not simply cancel when they share bits
+unsigned long long LinkedListContext::sampleRank(unsigned int somePosition) {
+   return(mixBits(sampleSeed ^ mixBits(somePosition)));
+}
+
+// X------------------------------------X
+// |    #mixBits(unsigned long long)    |
+// X------------------------------------X
+// The splitmix64 finalizer (Steele, Lea & Flood, 2014)
+unsigned long long LinkedListContext::mixBits(unsigned long long someBits) {
+   someBits = (someBits ^ (someBits >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   someBits = (someBits ^ (someBits >> 27)) * 0x94D049BB133111EBULL;
+   return(someBits ^ (someBits >> 31));
 }
 
 
@@ -326,11 +499,20 @@ void LinkedListContext::reset() {
 //
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
+// X-------------------------------------X
+// |    #KeyKeyword::operator()(LLC&)    |
+// X-------------------------------------X
+// Hands BSTGeneric the keyword this list is ordered by, without copying it
+const string& LinkedListContext::KeyKeyword::operator()(const LinkedListContext& someLinkedList) const {
+   return(someLinkedList.keywordText());
+}
+
 // X-------------------X
 // |    #toString()    |
 // X-------------------X
-// Outputs the entire linked list as a string
-string LinkedListContext::toString() {
+// Outputs every occurrence as an aligned KWIC line, restricted to documentFilter when one is set.
+// Contexts are rebuilt from the archive one position at a time as the postings are decoded.
+string LinkedListContext::toString() const {
    // cout << "LLC toString() called! formatLength: " << formatLength << endl; // DEBUG
    // #reString - The return string
    string retString = "";
@@ -340,46 +522,255 @@ string LinkedListContext::toString() {
    string pad = "";
    // #keypad - Number of spaces needed to pad out the previous context
    string keypad = "";
-
-   // Starting at the first node...
-   this->reset();
-   // cout << "LLC.toString() reset complete. currPtr: " << currPtr << endl; // DEBUG
-   // Determine the pad width
-   for (int i = 0 ; i < (formatLength - currPtr->lengthOfPrevContext) ; i++) {
-      // cout << "Padding."; // DEBUG
-      pad = pad + " ";
+   // #occurrenceIndex - Index of the current occurrence
+   unsigned int occurrenceIndex = 0;
+   // #nextRunStart - Index of the first occurrence of the next run, or the occurrence count after the final run
+   unsigned int nextRunStart = 0;
+   // #documentID - Document of the current occurrence
+   unsigned int documentID = 0;
+   // #shownKeyword - The keyword as displayed: whole, unless fixed widths cut it to keywordFormatLength
+   string shownKeyword = keywordText();
+   if (isWidthFixed && (signed)shownKeyword.length() > keywordFormatLength) {
+      shownKeyword.erase(keywordFormatLength);
    }
+
    // determine the keypad width (only needs to be done once per LinkedListContext, since all keywords should be the same
-   for (int i = 0 ; i < (keywordFormatLength - (signed)this->keyword.length()) ; i++) { // keywordFormatLength @ 
+   for (int i = 0 ; i < (keywordFormatLength - (signed)shownKeyword.length()) ; i++) { // keywordFormatLength @ 
       // cout << "Keypadding."; // DEBUG
       keypad = keypad + " ";
    }
+   // When collapsing repeats, a first pass groups the occurrences by window. The hash covers the document,
+   // so each group lies within one document. A hash shared by a different window leaves that occurrence
+   // out of the group, and it renders as a line of its own.
+   // #windowHashes - Window hash of each occurrence, by index
+   vector<unsigned long long> windowHashes;
+   // #windowGroups - First position and multiplicity of each window, by window hash
+   unordered_map<unsigned long long, pair<unsigned int, unsigned int> > windowGroups;
+   if (collapseRepeats) {
+      windowHashes.reserve(occurrencePositions.getCount());
+      ListPostings::Cursor groupCursor(occurrencePositions);
+      while (groupCursor.hasNext()) {
+         unsigned int thisPosition = groupCursor.next();
+         windowHashes.push_back(archivePtr->getWindowHash(thisPosition, phraseLength));
+         pair<unordered_map<unsigned long long, pair<unsigned int, unsigned int> >::iterator, bool> insertResult =
+            windowGroups.insert(make_pair(windowHashes.back(), make_pair(thisPosition, 1u)));
+         if (!insertResult.second && archivePtr->isSameWindow(insertResult.first->second.first, thisPosition, phraseLength)) {
+            insertResult.first->second.second++;
+         }
+      }
+   }
+   // The runs are decoded alongside the positions
+   ListPostings::Cursor documentCursor(runDocuments);
+   ListPostings::Cursor startCursor(runStarts);
+   if (startCursor.hasNext()) {
+      nextRunStart = startCursor.next();
+   }
 
-   // Append the pad, context, gap, keyword, keyword gap, gap, context, and a line break to the return string
-   // cout << "LLC.toString() - Appending..." << endl; // DEBUG
-   retString = retString+ pad + currPtr->prevContext + gap + keyword + keypad + gap + currPtr->postContext + "\n";
-   // cout << "LLC.toString() - First append completed." << endl; // DEBUG
-
-   // And while we haven't run off the end of the list...
-   while (!this->isLastNode()) {
-      // retString = retString + "$"; // DEBUG
-      // cout << "LLC.toString() while-loop activated." << endl; // DEBUG
-      // Move forward one node
-      this->advance();
-      // And repeat
+   // Starting at the first occurrence, and while we haven't run off the end of the list...
+   // Invariant: documentID is the document of the run holding occurrence occurrenceIndex - 1
+   ListPostings::Cursor positionCursor(occurrencePositions);
+   while (positionCursor.hasNext()) {
+      unsigned int thisPosition = positionCursor.next();
+      // Step into the next run at its first occurrence
+      if (occurrenceIndex == nextRunStart) {
+         documentID = documentCursor.next();
+         nextRunStart = occurrencePositions.getCount();
+         if (startCursor.hasNext()) {
+            nextRunStart = startCursor.next();
+         }
+      }
+      occurrenceIndex++;
+      // Skip occurrences from other documents
+      if (documentFilter != -1 && documentID != (unsigned int)documentFilter) {
+         continue;
+      }
+      // A repeated window renders once, at its first occurrence, marked with how many share it
+      string repeatMark = "";
+      if (collapseRepeats) {
+         const pair<unsigned int, unsigned int>& thisGroup = windowGroups[windowHashes[occurrenceIndex - 1]];
+         if (thisGroup.first != thisPosition) {
+            if (archivePtr->isSameWindow(thisGroup.first, thisPosition, phraseLength)) {
+               continue;
+            }
+         }
+         else if (thisGroup.second > 1) {
+            repeatMark = gap + "(x" + to_string(thisGroup.second) + ")";
+         }
+      }
+      string prevContext = archivePtr->getPrevContext(thisPosition);
+      // A fixed width keeps the end of a longer context, the words nearest the keyword
+      if (isWidthFixed && (signed)prevContext.length() > LinkedListContext::formatLength) {
+         prevContext.erase(0, prevContext.length() - LinkedListContext::formatLength);
+      }
       // Reset the pads
       pad = "";
-      // Redetermine the pad width
-      for (int i = 0 ; i < (LinkedListContext::formatLength - currPtr->lengthOfPrevContext) ; i++) {
+      // Determine the pad width
+      for (int i = 0 ; i < (LinkedListContext::formatLength - (signed)prevContext.length()) ; i++) {
          pad = pad + " ";
       }
       // Append the pad, context, gap, keyword, keywordgap, gap, context, and a line break to the return string
-      retString = retString + pad + currPtr->prevContext + gap + keyword + keypad + gap + currPtr->postContext + "\n";
+      // (Appended in place: rebuilding the string per line made a keyword's rendering quadratic in its occurrences)
+      retString += pad;
+      retString += prevContext;
+      retString += gap;
+      retString += shownKeyword;
+      retString += keypad;
+      retString += gap;
+      retString += archivePtr->getPostContext(thisPosition + phraseLength - 1);
+      retString += repeatMark;
+      retString += "\n";
+   }
+   // A capped list ends with a line giving how many occurrences it sampled, under the keyword
+   if (occurrenceTotal > occurrencePositions.getCount()) {
+      retString = retString + string(LinkedListContext::formatLength, ' ') + gap + shownKeyword + keypad + gap + "(" + to_string(occurrencePositions.getCount())
+                + " of " + to_string(occurrenceTotal) + " occurrences sampled)\n";
    }
    // cout << "LLC.toString() successful!" << endl; // DEBUG
    return(retString);
 }
 
+// X-----------------------------------------X
+// |    #writeRecords(WriterConcordance&)    |
+// X-----------------------------------------X
+// The occurrences are decoded once and counted under the document filter, since a list's records
+// announce how many follow
+void LinkedListContext::writeRecords(WriterConcordance& someWriter) const {
+   vector<unsigned int> listPositions;
+   vector<unsigned int> listDocuments;
+   decodeOccurrences(listPositions, listDocuments);
+   unsigned int keptCount = 0;
+   for (unsigned int i = 0 ; i < listDocuments.size() ; i++) {
+      if (documentFilter == -1 || listDocuments[i] == (unsigned int)documentFilter) {
+         keptCount++;
+      }
+   }
+   if (keptCount == 0) {
+      return;
+   }
+   someWriter.beginList(keywordText(), keptCount, (documentFilter == -1) ? occurrenceTotal : keptCount);
+   for (unsigned int i = 0 ; i < listPositions.size() ; i++) {
+      if (documentFilter == -1 || listDocuments[i] == (unsigned int)documentFilter) {
+         someWriter.writeOccurrence(*archivePtr, listDocuments[i], listPositions[i], phraseLength);
+      }
+   }
+   someWriter.endList();
+}
+
+
+
+// X-------------------------------------X
+// |    #removeDocument(unsigned int)    |
+// X-------------------------------------X
+// Drops every occurrence of one document. Occurrences of a document are contiguous (one run), so the
+// postings are re-encoded without that slice and the later runs start that many occurrences earlier.
+bool LinkedListContext::removeDocument(unsigned int someDocumentID) {
+   // #firstIndex - Index of the first occurrence of the document's run
+   unsigned int firstIndex = 0;
+   // #endIndex - Index one past the last occurrence of the document's run
+   unsigned int endIndex = 0;
+   // #isFound - Whether the document has a run in this list
+   bool isFound = false;
+   ListPostings::Cursor documentCursor(runDocuments);
+   ListPostings::Cursor startCursor(runStarts);
+   while (documentCursor.hasNext()) {
+      unsigned int documentID = documentCursor.next();
+      unsigned int runStart = startCursor.next();
+      // The run after the document's own marks where it ends
+      if (isFound) {
+         endIndex = runStart;
+         break;
+      }
+      if (documentID == someDocumentID) {
+         isFound = true;
+         firstIndex = runStart;
+         endIndex = occurrencePositions.getCount();
+      }
+      // Runs are in document order, so no later run can match
+      else if (documentID > someDocumentID) {
+         break;
+      }
+   }
+   if (isFound) {
+      // Re-encode the postings without occurrences [firstIndex, endIndex)
+      ListPostings keptPositions;
+      ListPostings::Cursor positionCursor(occurrencePositions);
+      for (unsigned int i = 0 ; positionCursor.hasNext() ; i++) {
+         unsigned int thisPosition = positionCursor.next();
+         if (i < firstIndex || i >= endIndex) {
+            keptPositions.append(thisPosition);
+         }
+      }
+      // And the runs without the document's own, shifting later starts down by its length
+      ListPostings keptDocuments;
+      ListPostings keptStarts;
+      ListPostings::Cursor runCursor(runDocuments);
+      ListPostings::Cursor runStartCursor(runStarts);
+      while (runCursor.hasNext()) {
+         unsigned int documentID = runCursor.next();
+         unsigned int runStart = runStartCursor.next();
+         if (documentID == someDocumentID) {
+            continue;
+         }
+         keptDocuments.append(documentID);
+         if (runStart > firstIndex) {
+            runStart = runStart - (endIndex - firstIndex);
+         }
+         keptStarts.append(runStart);
+      }
+      std::swap(occurrencePositions, keptPositions);
+      std::swap(runDocuments, keptDocuments);
+      std::swap(runStarts, keptStarts);
+      occurrenceTotal = occurrenceTotal - (endIndex - firstIndex);
+   }
+   return(occurrencePositions.getCount() == 0);
+}
+
+// X-----------------------------------X
+// |    #expireBefore(unsigned int)    |
+// X-----------------------------------X
+// Drops the leading occurrences below someCutoff. Run starts index into the occurrences, so they move down
+// by the number dropped, and runs left with no occurrence go. A list with one run keeps its start of 0.
+bool LinkedListContext::expireBefore(unsigned int someCutoff) {
+   unsigned int droppedCount = occurrencePositions.dropBefore(someCutoff);
+   occurrenceTotal = occurrenceTotal - droppedCount;
+   if (droppedCount == 0 || runDocuments.getCount() == 1) {
+      return(occurrencePositions.getCount() == 0);
+   }
+   unsigned int keptCount = occurrencePositions.getCount();
+   ListPostings keptDocuments;
+   ListPostings keptStarts;
+   ListPostings::Cursor runCursor(runDocuments);
+   ListPostings::Cursor runStartCursor(runStarts);
+   unsigned int documentID = runCursor.next();
+   unsigned int runStart = runStartCursor.next();
+   // Invariant: documentID and runStart describe the run under test; its end is the next run's start
+   while (true) {
+      bool isLast = !runCursor.hasNext();
+      unsigned int nextDocumentID = isLast ? 0 : runCursor.next();
+      unsigned int runEnd = isLast ? (droppedCount + keptCount) : runStartCursor.next();
+      if (runEnd > droppedCount) {
+         keptDocuments.append(documentID);
+         keptStarts.append((runStart > droppedCount) ? runStart - droppedCount : 0);
+      }
+      if (isLast) {
+         break;
+      }
+      documentID = nextDocumentID;
+      runStart = runEnd;
+   }
+   std::swap(runDocuments, keptDocuments);
+   std::swap(runStarts, keptStarts);
+   return(keptCount == 0);
+}
+
+// X-------------------------------------X
+// |    #shiftPositions(unsigned int)    |
+// X-------------------------------------X
+// Lowers every occurrence position by someShift. Runs index occurrences, not positions, so they stay.
+void LinkedListContext::shiftPositions(unsigned int someShift) {
+   occurrencePositions.shiftDown(someShift);
+}
+
 
 
 //-------|---------|---------|---------|---------|---------|---------|---------|
@@ -398,14 +789,15 @@ string LinkedListContext::toString() {
 // Return value:     
 // Functions called: 
 LinkedListContext::LinkedListContext() {
+   keywordID = noKeyword;
+   occurrenceTotal = 0;
+   sampleBound = 0;
    // cout << "LLC.LLC() - Default constructor called." << endl; // DEBUG
 //   keyword = ".";
    // cout << "LLC.LLC() Keyword: " << keyword << endl; // DEBUG
-   currPtr = nullptr;
-   headNodePtr = nullptr;
 }
 
-// #LinkedListContext(string, string, string) - Makes a context linked list with a keyword and head node
+// #LinkedListContext(string, unsigned int, unsigned int, int) - Makes a context list with a keyword and one occurrence
 // X-----------------------X
 // |    #NAME    |
 // X-----------------------X
@@ -415,19 +807,39 @@ LinkedListContext::LinkedListContext() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-LinkedListContext::LinkedListContext(string prevContext, string someKeyword, string postContext) {
-   keyword = someKeyword;
+LinkedListContext::LinkedListContext(string someKeyword, unsigned int somePosition, unsigned int documentID, int lengthOfPrevContext) {
+   keywordID = internKeyword(someKeyword, somePosition);
+   // The first occurrence is the first of its document
+   appendRun(documentID, 0);
    // Update the maximum observed keyword length
-   if ((signed)keyword.length() > keywordFormatLength) {
-      keywordFormatLength = keyword.length();
+   if ((signed)someKeyword.length() > keywordFormatLength && !isWidthFixed) {
+      keywordFormatLength = someKeyword.length();
    }
-   headNodePtr = new NodeContext(prevContext, postContext);
-   currPtr = headNodePtr;
-   if (headNodePtr->lengthOfPrevContext > LinkedListContext::formatLength) {
-      LinkedListContext::formatLength = headNodePtr->lengthOfPrevContext;
+   occurrencePositions.append(somePosition);
+   occurrenceTotal = 1;
+   sampleBound = (occurrenceCap > 0) ? (unsigned int)(sampleRank(somePosition) >> 32) : 0;
+   if (lengthOfPrevContext > LinkedListContext::formatLength && !isWidthFixed) {
+      LinkedListContext::formatLength = lengthOfPrevContext;
    } // Ensures that the formatLength will be equal to the longest observed prevContext length
 }
 
+// X-----------------------------------------------X
+// |    #LinkedListContext(LinkedListContext&&)    |
+// X-----------------------------------------------X
+// Move constructor. Each field starts empty and is swapped with someLinkedList's, which is left empty.
+// No byte buffer is copied, and a list short enough for small-string storage never touched the heap.
+LinkedListContext::LinkedListContext(LinkedListContext&& someLinkedList) {
+   keywordID = someLinkedList.keywordID;
+   someLinkedList.keywordID = noKeyword;
+   std::swap(occurrencePositions, someLinkedList.occurrencePositions);
+   std::swap(runDocuments, someLinkedList.runDocuments);
+   std::swap(runStarts, someLinkedList.runStarts);
+   occurrenceTotal = someLinkedList.occurrenceTotal;
+   someLinkedList.occurrenceTotal = 0;
+   sampleBound = someLinkedList.sampleBound;
+   someLinkedList.sampleBound = 0;
+}
+
 // #~LinkedListContext() - Destructor
 // X-----------------------X
 // |    #NAME    |
@@ -440,38 +852,7 @@ LinkedListContext::LinkedListContext(string prevContext, string someKeyword, str
 // Functions called: 
 LinkedListContext::~LinkedListContext() {
    // cout << "Destructo Presto!" << endl; // DEBUG
-   if (this->headNodePtr == nullptr) {
-      // cout << "Nothing to see here. Exiting!" << endl;
-      return;
-   }
-   NodeContext* prevNodePtr = this->headNodePtr;
-   // While a body node still exists...
-   this->currPtr = this->headNodePtr;
-   if (this->currPtr == nullptr) {
-      // cout << "Nothing to see here either" << endl;
-   }
-   // cout << "Attempting to advance to end: " << headNodePtr << ":" << currPtr << endl;
-
-   while (this->headNodePtr->nextPtr != nullptr) {
-      // cout << "headNode.nextPtr != nullptr" << endl;
-      // Advance to the end
-      // TODO: Need a test here: What if currPtr is nullptr because the head node was also nullptr when it was assigned on 194? There's no nextPtr to dereference.
-      while (this->currPtr->nextPtr != nullptr) { // Read Access Violation
-         prevNodePtr = this->currPtr;
-         this->advance();
-         //cout << "Crossing over " << this->currPtr->prevContext << ":" << this->currPtr->postContext << endl; // DEBUG
-      } // Closing while loop, curr points to last node, prev points to second to last
-      // And delete it
-      delete this->currPtr;
-      // And remove the previous pointer
-      prevNodePtr->nextPtr = nullptr;
-      this->currPtr = this->headNodePtr;
-      prevNodePtr = this->headNodePtr;
-   } // Body nodes are all deleted
-
-   // cout << "Deleting Head Node: " << endl; // DEBUG
-   // cout << "Deallocating " << this->headNodePtr->prevContext << ":" << this->headNodePtr->postContext << endl; // DEBUG
-   delete this->headNodePtr;
+   // Nothing to release: the postings and runs own their storage
 }
 
 
@@ -482,7 +863,6 @@ LinkedListContext::~LinkedListContext() {
 //
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
-// #getPrevContext() - Returns the previous context of the current node
 // X-----------------------X
 // |    #NAME    |
 // X-----------------------X
@@ -492,35 +872,101 @@ LinkedListContext::~LinkedListContext() {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-string LinkedListContext::getPrevContext(const NodeContext* currNodePtr) const {
-   return(currNodePtr->prevContext);
+string LinkedListContext::getKeyword() const {
+   return (keywordText());
 }
 
-// X-----------------------X
-// |    #NAME    |
-// X-----------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string LinkedListContext::getKeyword() const {
-   return (keyword);
+// X-----------------------------X
+// |    #getOccurrenceCount()    |
+// X-----------------------------X
+// Returns the number of occurrences of the keyword
+unsigned int LinkedListContext::getOccurrenceCount() const {
+   return(occurrencePositions.getCount());
+}
+
+// X-----------------------------X
+// |    #getOccurrenceTotal()    |
+// X-----------------------------X
+// Returns the number of occurrences read, counting those a capped list sampled away
+unsigned int LinkedListContext::getOccurrenceTotal() const {
+   return(occurrenceTotal);
 }
 
-// #getPostContext() - Returns the post context of the current node
 // X-----------------------X
-// |    #NAME    |
+// |    #getPositions()    |
 // X-----------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string LinkedListContext::getPostContext(const NodeContext* currNodePtr) const {
-      return(currNodePtr->postContext);
+// Returns the token position of every occurrence, in corpus order
+const ListPostings& LinkedListContext::getPositions() const {
+   return(occurrencePositions);
+}
+
+// X--------------------------X
+// |    #getFormatLength()    |
+// X--------------------------X
+// Returns the width previous contexts are right-aligned to
+int LinkedListContext::getFormatLength() {
+   return(formatLength);
+}
+
+// X-------------------------------X
+// |    #widenFormatLength(int)    |
+// X-------------------------------X
+// Widens the previous-context alignment to someLength, as the constructor does for a new occurrence
+void LinkedListContext::widenFormatLength(int someLength) {
+   if (someLength > LinkedListContext::formatLength && !isWidthFixed) {
+      LinkedListContext::formatLength = someLength;
+   }
+}
+
+// X---------------------------------X
+// |    #setFixedWidths(int, int)    |
+// X---------------------------------X
+// Fixes both widths for every LinkedListContext; nothing widens them afterwards
+void LinkedListContext::setFixedWidths(int somePrevWidth, int someKeywordWidth) {
+   formatLength = (somePrevWidth > 0) ? somePrevWidth : 1;
+   keywordFormatLength = (someKeywordWidth > 0) ? someKeywordWidth : 1;
+   isWidthFixed = true;
+}
+
+// X-------------------------------X
+// |    #setDocumentFilter(int)    |
+// X-------------------------------X
+// Restricts toString() to a single document for every LinkedListContext. -1 lifts the restriction.
+void LinkedListContext::setDocumentFilter(int someDocumentID) {
+   documentFilter = someDocumentID;
+}
+
+// X-----------------------------------------X
+// |    #setArchive(const ArchiveCorpus*)    |
+// X-----------------------------------------X
+// Sets the token store that every occurrence position refers to
+void LinkedListContext::setArchive(const ArchiveCorpus* someArchivePtr) {
+   archivePtr = someArchivePtr;
+}
+
+// X---------------------------------X
+// |    #setCollapseRepeats(bool)    |
+// X---------------------------------X
+// Chooses whether every LinkedListContext renders a repeated window once
+void LinkedListContext::setCollapseRepeats(bool isCollapsed) {
+   collapseRepeats = isCollapsed;
+}
+
+// X--------------------------------------X
+// |    #setPhraseLength(unsigned int)    |
+// X--------------------------------------X
+// Sets the words every keyword spans, so post contexts start after the last of them
+void LinkedListContext::setPhraseLength(unsigned int someLength) {
+   phraseLength = (someLength > 0) ? someLength : 1;
+}
+
+// X-----------------------------------------------------------X
+// |    #setOccurrenceCap(unsigned int, unsigned long long)    |
+// X-----------------------------------------------------------X
+// Caps the occurrences every list holds, sampling under someSeed. 0 holds every occurrence.
+void LinkedListContext::setOccurrenceCap(unsigned int someCap, unsigned long long someSeed) {
+   occurrenceCap = someCap;
+   sampleSeed = someSeed;
 }
 
 
@@ -542,7 +988,7 @@ string LinkedListContext::getPostContext(const NodeContext* currNodePtr) const {
 // Return value:     
 // Functions called: 
 bool LinkedListContext::operator<(const LinkedListContext& someLinkedList) const {
-   if (this->keyword < someLinkedList.keyword) {
+   if (this->keywordText() < someLinkedList.keywordText()) {
       return(true);
    }
    else {
@@ -561,7 +1007,7 @@ bool LinkedListContext::operator<(const LinkedListContext& someLinkedList) const
 // Return value:     
 // Functions called: 
 bool LinkedListContext::operator>(const LinkedListContext& someLinkedList) const {
-   if (this->keyword > someLinkedList.keyword) {
+   if (this->keywordText() > someLinkedList.keywordText()) {
       return(true);
    }
    else {
@@ -569,47 +1015,79 @@ bool LinkedListContext::operator>(const LinkedListContext& someLinkedList) const
    }
 }
 
-// X--------------------------------------X
-// |    #operator=(LinkedListContext&)    |
-// X--------------------------------------X
-// Description:      Custom behavior for the assignment operator. Appends the RH context list to the receiving context list
+// X--------------------------------------------X
+// |    #operator=(const LinkedListContext&)    |
+// X--------------------------------------------X
+// Description:      Custom behavior for the assignment operator. Appends the RH occurrences to the receiving list
 // Parameters:       
-// Preconditions:    
+// Preconditions:    Every RH occurrence follows every occurrence already held (corpus order)
 // Postconditions:   
 // Return value:     
-// Functions called: 
-LinkedListContext& LinkedListContext::operator=(LinkedListContext& RHarg) {
+// Functions called: ListPostings::appendAll(), appendRun()
+LinkedListContext& LinkedListContext::operator=(const LinkedListContext& RHarg) {
    // Check to see if "this" and "RHarg" are the same thing
    if (this == &RHarg) { // Compares reference addresses
       // cout << "LLC assignment attempted on self. Returning." << endl; // DEBUG
       return *this; // If the same, bail.
    }
    // The two linked lists are different...
-   if (this != &RHarg) {
-      // cout << "This LLC keyword: " << this->keyword << endl;
-      // cout << "That LLC keyword: " << RHarg.keyword << endl;
-      this->keyword = RHarg.keyword;
-      // If they aren't... target the first Linked List Node of the RH argument
-      NodeContext* targetNodePtr = RHarg.headNodePtr;
-      // cout << "TargetNodePtr: " << targetNodePtr->prevContext << targetNodePtr->postContext;
-      // And while the target isn't nullptr...
-      while(targetNodePtr != nullptr) {
-         // cout << "LLC.operator= appending..." << endl;
-         // cout << "AppendingPrev: " << this->getPrevContext(this->headNodePtr) << endl; // BUG - Attempting to access a nullptr
-         // cout << "AppendingPost: " << this->getPostContext(this->headNodePtr) << endl; // BUG - Attempting to access a nullptr
-         // cout << "AppendingPrev: " << RHarg.getPrevContext(targetNodePtr) << endl;
-         // cout << "AppendingPost: " << RHarg.getPostContext(targetNodePtr) << endl;
-         // Append RHarg context to LHS (this)
-         this->append(RHarg.getPrevContext(targetNodePtr), RHarg.getPostContext(targetNodePtr));
-         // cout << "LLC.operator= Append() complete! Advancing target..." << endl;
-         // Advance the target
-         targetNodePtr = targetNodePtr->nextPtr;
-      } // Closing while loop - All RHarg contexts have been appended to the LHarg
+   this->keywordID = RHarg.keywordID;
+   // A capped list that would pass its cap samples what it receives instead of appending all of it
+   if (occurrenceCap > 0 && this->occurrencePositions.getCount() > 0 && this->occurrenceTotal + RHarg.occurrenceTotal > occurrenceCap) {
+      if (RHarg.occurrenceTotal > RHarg.occurrencePositions.getCount()) {
+         this->mergeSample(RHarg);
+      }
+      // A single occurrence, as the reader hands over, needs no decoding
+      else if (RHarg.occurrenceTotal == 1) {
+         this->offerOccurrence(RHarg.occurrencePositions.getLastPosition(), RHarg.runDocuments.getLastPosition());
+      }
+      else {
+         vector<unsigned int> addedPositions;
+         vector<unsigned int> addedDocuments;
+         RHarg.decodeOccurrences(addedPositions, addedDocuments);
+         for (unsigned int i = 0 ; i < addedPositions.size() ; i++) {
+            this->offerOccurrence(addedPositions[i], addedDocuments[i]);
+         }
+      }
+      return *this;
+   }
+   // Carry the RHarg document runs across, each starting after the occurrences already held
+   unsigned int baseIndex = this->occurrencePositions.getCount();
+   ListPostings::Cursor documentCursor(RHarg.runDocuments);
+   ListPostings::Cursor startCursor(RHarg.runStarts);
+   while (documentCursor.hasNext()) {
+      unsigned int documentID = documentCursor.next();
+      this->appendRun(documentID, baseIndex + startCursor.next());
    }
+   // Append RHarg positions to LHS (this)
+   this->occurrencePositions.appendAll(RHarg.occurrencePositions);
+   this->occurrenceTotal = this->occurrenceTotal + RHarg.occurrenceTotal;
+   this->sampleBound = max(this->sampleBound, RHarg.sampleBound);
    // cout << "Closing LLC.operator=()" << endl << endl;
    return *this;
 }
 
+// X---------------------------------------X
+// |    #operator=(LinkedListContext&&)    |
+// X---------------------------------------X
+// Assignment from a list about to be discarded. An empty list swaps storage with it; otherwise the
+// occurrences are appended as by operator=(const LinkedListContext&), which is the common case in a tree hit.
+LinkedListContext& LinkedListContext::operator=(LinkedListContext&& RHarg) {
+   if (this == &RHarg) {
+      return *this;
+   }
+   if (this->occurrencePositions.getCount() == 0) {
+      std::swap(keywordID, RHarg.keywordID);
+      std::swap(occurrencePositions, RHarg.occurrencePositions);
+      std::swap(runDocuments, RHarg.runDocuments);
+      std::swap(runStarts, RHarg.runStarts);
+      std::swap(occurrenceTotal, RHarg.occurrenceTotal);
+      std::swap(sampleBound, RHarg.sampleBound);
+      return *this;
+   }
+   return(*this = RHarg);
+}
+
 // X---------------------------------------X
 // |    #operator==(LinkedListContext&)    |
 // X---------------------------------------X
@@ -620,10 +1098,7 @@ LinkedListContext& LinkedListContext::operator=(LinkedListContext& RHarg) {
 // Return value:     
 // Functions called: 
 bool LinkedListContext::operator==(const LinkedListContext& RHarg) const {
-   // Determine incoming context
-   string appPreCont = RHarg.getPrevContext(RHarg.headNodePtr);
-   string appPostCont = RHarg.getPostContext(RHarg.headNodePtr);
-   if (this->keyword == RHarg.keyword) {
+   if (this->keywordText() == RHarg.keywordText()) {
       // cout << "LLC.op== : Keywords equal. " << this->keyword << " vs " << RHarg.keyword << endl; // DEBUG
       return(true);
    }
@@ -634,7 +1109,7 @@ bool LinkedListContext::operator==(const LinkedListContext& RHarg) const {
 }
 
 // #operator<< - Custom behavior for the stream insertion operator for this (RHarg) and another LinkedListContext (LHarg)
-ostream& operator<<(ostream& coutStream, LinkedListContext& someLinkedList) {
+ostream& operator<<(ostream& coutStream, const LinkedListContext& someLinkedList) {
    // cout << "LLC.op<<() called"; // DEBUG
    string thisLinkedList = "";
    // <Implement all string appending here>
@@ -162,8 +162,29 @@
 // Necessary for string operations
 #include <string>
 
-// Node definition for a context node (holding data1, data2, next)
-// #include "NodeContext.cpp"
+// Necessary for std::move (handing lists into and out of tree nodes)
+#include <utility>
+
+// Necessary for the shared format widths (atomic), widened by the writer while snapshot readers render
+#include <atomic>
+
+// Necessary for vector operations (decoding a capped list's sample to resample it)
+#include <vector>
+
+// Necessary for hash table operations (grouping the occurrences that share a window)
+#include <unordered_map>
+
+// Compressed token positions of the occurrences
+#include "ListPostings.h"
+
+// Token store that the occurrence contexts are rebuilt from, and whose vocabulary holds the keywords
+#include "ArchiveCorpus.h"
+
+// Append-only storage for the n-gram keywords, readable while lists are built
+#include "VectorChunked.h"
+
+// Machine-readable record output (writeRecords())
+#include "WriterConcordance.h"
 
 using namespace std;
 
@@ -171,30 +192,9 @@ using namespace std;
 // |    #LinkedListContext    |
 // X--------------------------X
 // Description: Performs corpus-related operations.
+//              Holds one keyword and every occurrence of it. Occurrences are token positions into the
+//              shared ArchiveCorpus, compressed in a ListPostings, and their contexts are rebuilt on output.
 class LinkedListContext {
-protected:
-struct NodeContext {
-   string prevContext;
-   string postContext;
-   NodeContext* nextPtr;
-   int lengthOfPrevContext;
-
-   NodeContext() {
-      prevContext = "Default NodeContext()";
-      postContext = "For Test Purpose Only";
-      nextPtr = nullptr;
-      lengthOfPrevContext = 0;
-   }
-
-   NodeContext(string wordsBefore, string wordsAfter) {
-      prevContext = wordsBefore;
-      postContext = wordsAfter;
-      lengthOfPrevContext = wordsBefore.length();
-      nextPtr = nullptr;
-   }
-};
-
-
 private:
 //-------|---------|---------|---------|---------|---------|---------|---------|
 //
@@ -202,60 +202,156 @@ private:
 //
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-NodeContext* currPtr;
+// X----------------------------X
+// |    #occurrencePositions    |
+// X----------------------------X
+// Description: Token position of every occurrence of the keyword, in corpus order
+// Invariants:  Strictly increasing
+ListPostings occurrencePositions;
+
+// X------------------------X
+// |    #occurrenceTotal    |
+// X------------------------X
+// Description: Number of occurrences of the keyword read, including those a capped list no longer holds
+// Invariants:  Equals occurrencePositions.getCount() unless the list is capped, ie. occurrenceCap > 0
+unsigned int occurrenceTotal;
+
+// X--------------------X
+// |    #sampleBound    |
+// X--------------------X
+// Description: High 32 bits of the largest sampleRank() held, so that a capped list turns most occurrences
+//              away without decoding. Sits beside occurrenceTotal, in what would otherwise be padding.
+// Invariants:  0 while the list is empty or uncapped
+unsigned int sampleBound;
 
 // X-----------------------------------X
 // |    #NAME    |
 // X-----------------------------------X
-// Description:      
+// Description:      Longest previous context seen, the width previous contexts are right-aligned to.
+//                   Atomic, as a snapshot reader may render while the writer widens it.
 // Parameters:       
 // Preconditions:    
 // Postconditions:   
 // Return value:     
 // Functions called: 
-NodeContext* headNodePtr;
+static atomic<int> formatLength;
 
 // X-----------------------------------X
 // |    #NAME    |
 // X-----------------------------------X
-// Description:      
+// Description:      Longest keyword seen, the width keywords are padded to. Atomic, as formatLength.
 // Parameters:       
 // Preconditions:    
 // Postconditions:   
 // Return value:     
 // Functions called: 
-static int formatLength;
+static atomic<int> keywordFormatLength;
+
+// X------------------X
+// |    #keywordID    |
+// X------------------X
+// Description: The keyword, interned. A single word is its word ID in the archive, whose vocabulary already
+//              holds its characters; anything else (an n-gram) is phraseFlag plus its index in phraseKeywords.
+//              The list never holds the characters itself, so a container keyed by them stores none.
+// Invariants:  noKeyword while the list is default-constructed or moved from
+unsigned int keywordID;
+
+// X---------------------X
+// |    #runDocuments    |
+// X---------------------X
+// Description: Document of each run of consecutive occurrences drawn from one document, in order.
+//              Occurrences are appended in corpus order, so each document holds a single run and the
+//              IDs strictly increase: they compress as a ListPostings exactly as positions do.
+// Invariants:  Same count as runStarts.
+ListPostings runDocuments;
 
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-static int keywordFormatLength;
+// X-------------------X
+// |    #runStarts    |
+// X-------------------X
+// Description: Index (into occurrencePositions) of the first occurrence of each run. A run ends where
+//              the next one starts, or at the last occurrence. Both run lists stay in small-string
+//              storage for a keyword seen in a handful of documents, so a one-occurrence list owns no heap block.
+// Invariants:  First entry is 0. Strictly increasing, each below occurrencePositions.getCount().
+ListPostings runStarts;
 
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string keyword; // Inherited from the BSTConcordance node
+// X-----------------------X
+// |    #documentFilter    |
+// X-----------------------X
+// Description: Document whose occurrences toString() emits. Shared by all lists, like formatLength.
+// Invariants:  -1 emits every document.
+static int documentFilter;
+
+// X-------------------X
+// |    #archivePtr    |
+// X-------------------X
+// Description: Token store that every occurrence position refers to. Shared by all lists, like formatLength.
+// Invariants:  Must be set before toString() is called on a non-empty list.
+static const ArchiveCorpus* archivePtr;
+
+// X----------------------X
+// |    #occurrenceCap    |
+// X----------------------X
+// Description: Most occurrences a list holds. Past it, a list keeps those of least sampleRank(): a
+//              uniform random sample of that size, fixed by the seed and the positions alone.
+//              Shared by all lists, like formatLength.
+// Invariants:  0 holds every occurrence
+static unsigned int occurrenceCap;
+
+// X-------------------X
+// |    #sampleSeed    |
+// X-------------------X
+// Description: Seed of every capped list's sampling, so the same seed samples the same occurrences
+// Invariants:  None
+static unsigned long long sampleSeed;
+
+// X------------------------X
+// |    #collapseRepeats    |
+// X------------------------X
+// Description: Render each distinct 11-word window of a list once, marked with its multiplicity, rather
+//              than once per occurrence. Shared by all lists, like formatLength.
+// Invariants:  None
+static bool collapseRepeats;
+
+// X---------------------X
+// |    #phraseLength    |
+// X---------------------X
+// Description: Words in every keyword, ie. n for an n-gram concordance. Each position is a keyword's first
+//              word, and its post context follows the keyword's last. Shared by all lists, like formatLength.
+// Invariants:  At least 1
+static unsigned int phraseLength;
+
+// X---------------------X
+// |    #isWidthFixed    |
+// X---------------------X
+// Description: Whether formatLength and keywordFormatLength were set up front (setFixedWidths()) rather than
+//              widened as occurrences arrive. Fixed widths are never widened, and toString() cuts a longer
+//              previous context or keyword to fit them. Shared by all lists, like formatLength.
+// Invariants:  None
+static bool isWidthFixed;
+
+// X-----------------------X
+// |    #phraseKeywords    |
+// X-----------------------X
+// Description: Each keyword the archive's vocabulary does not hold, ie. an n-gram, indexed by keywordID less
+//              phraseFlag, with the reverse lookup that interns them. Written only by the thread building
+//              lists. Shared by all lists, like formatLength.
+// Invariants:  No keyword appears twice
+static VectorChunked<string> phraseKeywords;
+static unordered_map<string, unsigned int> phraseIndex;
+
+// X------------------X
+// |    #phraseFlag    |
+// X------------------X
+// Description: Bit of keywordID that marks an index into phraseKeywords rather than an archive word ID
+// Invariants:  Above every word ID
+static const unsigned int phraseFlag = 0x80000000u;
+
+// X------------------X
+// |    #noKeyword    |
+// X------------------X
+// Description: keywordID of a list without a keyword, which reads as ""
+// Invariants:  Never an index actually interned
+static const unsigned int noKeyword = 0xFFFFFFFFu;
 
 
 
@@ -265,58 +361,119 @@ string keyword; // Inherited from the BSTConcordance node
 //
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
-// #advance() - If currPtr is not the last node, moves currPtr forward one body node per call
-// X----------------X
-// |    #NAME    |
-// X----------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-void advance();
-
-// #append(string, string) - Adds a new node to the Linked List using the provided contexts
-// X----------------X
-// |    #NAME    |
-// X----------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-void append(string prevContext, string postContext);
-
-// #isLastNode() - Reports whether the currPtr points to the last body node.
-// X----------------X
-// |    #NAME    |
-// X----------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-bool isLastNode();
-
-// #reset() - Sets the currPtr back to the head node
-// X----------------X
-// |    #reset()    |
-// X----------------X
-// #reset() - Sets the current node pointer to the head node
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-void reset();
+// X----------------------X
+// |    #keywordText()    |
+// X----------------------X
+// Description:      Returns the keyword's characters where they are held: the archive's vocabulary or phraseKeywords
+// Preconditions:    archivePtr is the archive the list was made against
+// Return value:     The keyword, "" for noKeyword
+// Functions called: ArchiveCorpus::getVocabularyEntry()
+const string& keywordText() const;
+
+// X--------------------------------------------X
+// |    #internKeyword(string, unsigned int)    |
+// X--------------------------------------------X
+// Description:      Finds the keywordID for a keyword first seen at a token position. The archived word at
+//                   that position is compared first, so a single word costs no lookup; anything else is
+//                   interned in phraseKeywords.
+// Parameters:       someKeyword - The keyword
+//                   somePosition - Token position of its first word
+// Return value:     The keywordID
+// Functions called: ArchiveCorpus::getWordID(), ArchiveCorpus::getVocabularyEntry()
+static unsigned int internKeyword(const string& someKeyword, unsigned int somePosition);
+
+// X----------------------------------------------X
+// |    #appendRun(unsigned int, unsigned int)    |
+// X----------------------------------------------X
+// Description:      Records that the occurrences from index someFirstIndex on belong to document someDocumentID
+// Parameters:       someDocumentID - Document of the occurrences, never below the final run's document
+//                   someFirstIndex - Index the first of those occurrences has (or will have) in occurrencePositions
+// Postconditions:   The final run is extended if it covers the same document, otherwise a run is added
+// Functions called: ListPostings::append()
+void appendRun(unsigned int someDocumentID, unsigned int someFirstIndex);
+
+// X-----------------------------------------------------X
+// |    #decodeOccurrences(vector<unsigned int>, ...)    |
+// X-----------------------------------------------------X
+// Description:      Unpacks every occurrence with the document that holds it
+// Parameters:       somePositions - Receives the occurrence positions, in corpus order
+//                   someDocuments - Receives the document of each occurrence
+// Preconditions:    Both vectors are empty
+// Postconditions:   None
+// Return value:     None
+// Functions called: ListPostings::Cursor::next()
+void decodeOccurrences(vector<unsigned int>& somePositions, vector<unsigned int>& someDocuments) const;
+
+// X------------------------------------------------------X
+// |    #rebuildOccurrences(vector<unsigned int>, ...)    |
+// X------------------------------------------------------X
+// Description:      Replaces the occurrences and runs with those given
+// Parameters:       somePositions - Occurrence positions, strictly increasing
+//                   someDocuments - The document of each occurrence, never decreasing
+// Preconditions:    Both vectors are the same length
+// Postconditions:   occurrenceTotal is unchanged
+// Return value:     None
+// Functions called: appendRun(), ListPostings::append()
+void rebuildOccurrences(const vector<unsigned int>& somePositions, const vector<unsigned int>& someDocuments);
+
+// X----------------------------------------------------X
+// |    #offerOccurrence(unsigned int, unsigned int)    |
+// X----------------------------------------------------X
+// Description:      Counts one more occurrence of a capped list and samples it (bottom-k sampling): it
+//                   displaces the held occurrence of greatest sampleRank() if its own rank is less
+// Parameters:       somePosition - Token position of the occurrence, after every one held
+//                   someDocumentID - Document holding the occurrence
+// Preconditions:    occurrenceCap > 0
+// Postconditions:   The list holds the min(occurrenceCap, occurrenceTotal) occurrences of least rank
+// Return value:     None
+// Functions called: sampleRank(), decodeOccurrences(), rebuildOccurrences()
+void offerOccurrence(unsigned int somePosition, unsigned int someDocumentID);
+
+// X----------------------------------------X
+// |    #mergeSample(LinkedListContext&)    |
+// X----------------------------------------X
+// Description:      Merges a sampled list of later occurrences into this capped list, keeping the
+//                   occurrenceCap of least sampleRank() from both
+// Parameters:       someLinkedList - A list holding the occurrences of least rank among its own occurrenceTotal
+// Preconditions:    occurrenceCap > 0. Every occurrence of someLinkedList follows every one held.
+// Postconditions:   The list holds the occurrences of least rank among the two lists' combined, the same
+//                   whichever way the occurrences were split between lists and batches
+// Return value:     None
+// Functions called: sampleRank(), decodeOccurrences(), rebuildOccurrences()
+void mergeSample(const LinkedListContext& someLinkedList);
+
+// X---------------------------------X
+// |    #sampleRank(unsigned int)    |
+// X---------------------------------X
+// Description:      Returns an occurrence's rank in the sample: the seed and its position, scrambled
+// Parameters:       somePosition - Token position of the occurrence
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     Uniform over the 64-bit range, and the same for a position under a seed however the
+//                   lists merge
+// Functions called: mixBits()
+static unsigned long long sampleRank(unsigned int somePosition);
+
+// X------------------------------------X
+// |    #mixBits(unsigned long long)    |
+// X------------------------------------X
+// Description:      Scrambles 64 bits (the splitmix64 finalizer), the sampling's source of randomness
+// Parameters:       someBits - Bits to scramble, ie. the seed combined with a position
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     The scrambled bits, spread uniformly across the range
+// Functions called: None
+static unsigned long long mixBits(unsigned long long someBits);
 
 
 
 public:
+// #KeyKeyword - Key policy for BSTGeneric, ie. BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>
+// Orders the tree by keyword alone, so a lookup by keyword string never builds a temporary list.
+struct KeyKeyword {
+   const string& operator()(const LinkedListContext& someLinkedList) const;
+};
+
 //-------|---------|---------|---------|---------|---------|---------|---------|
 //
 //       PUBLIC FIELDS
@@ -336,13 +493,65 @@ public:
 // X-------------------X
 // |    #toString()    |
 // X-------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string toString();
+// Description:      Renders one aligned KWIC line per occurrence, rebuilding each context from the archive.
+//                   A list holding a sample adds a line giving how many of its occurrences were sampled.
+//                   When repeats are collapsed, occurrences sharing a window render as one line, at the
+//                   first of them, ending in "(xN)".
+// Parameters:       None
+// Preconditions:    setArchive() has been called
+// Postconditions:   None
+// Return value:     The rendered lines, each ending in a line break
+// Functions called: ArchiveCorpus::getPrevContext(), ArchiveCorpus::getPostContext(),
+//                   ArchiveCorpus::getWindowHash(), ArchiveCorpus::isSameWindow()
+string toString() const;
+
+// X-----------------------------------------X
+// |    #writeRecords(WriterConcordance&)    |
+// X-----------------------------------------X
+// Description:      Writes the occurrences as records instead of aligned lines, so no padding is built.
+//                   The document filter and phrase length apply as for toString(); repeats are not
+//                   collapsed, and a sample is written with the total it was drawn from.
+// Parameters:       someWriter - The writer, in the format chosen
+// Preconditions:    setArchive() has been called
+// Postconditions:   None
+// Return value:     None
+// Functions called: decodeOccurrences(), WriterConcordance::beginList(), WriterConcordance::writeOccurrence(),
+//                   WriterConcordance::endList()
+void writeRecords(WriterConcordance& someWriter) const;
+
+// X------------------------------------X
+// |    #removeDocument(unsigned int)    |
+// X------------------------------------X
+// Description:      Drops every occurrence drawn from one document
+// Parameters:       someDocumentID - Document whose occurrences are removed
+// Preconditions:    None
+// Postconditions:   No occurrence of someDocumentID remains. Other occurrences keep their order.
+// Return value:     true if the list is now empty, so the keyword can be deleted
+// Functions called: ListPostings::append()
+bool removeDocument(unsigned int someDocumentID);
+
+// X-----------------------------------X
+// |    #expireBefore(unsigned int)    |
+// X-----------------------------------X
+// Description:      Drops the occurrences that have left a sliding window, ie. every one below its first position
+// Parameters:       someCutoff - First position still inside the window
+// Preconditions:    None
+// Postconditions:   Every occurrence left is at or after someCutoff. O(1) amortized per occurrence dropped
+//                   while the list spans a single document; O(documents) otherwise, as each run is renumbered.
+// Return value:     true if the list is now empty, so the keyword can be deleted
+// Functions called: ListPostings::dropBefore(), ListPostings::append()
+bool expireBefore(unsigned int someCutoff);
+
+// X-------------------------------------X
+// |    #shiftPositions(unsigned int)    |
+// X-------------------------------------X
+// Description:      Lowers every occurrence position by the same amount, to follow ArchiveCorpus::discardBefore()
+// Parameters:       someShift - Number of tokens the archive discarded
+// Preconditions:    Every occurrence is at or after someShift
+// Postconditions:   Document runs are unchanged
+// Return value:     None
+// Functions called: ListPostings::shiftDown()
+void shiftPositions(unsigned int someShift);
 
 
 
@@ -364,17 +573,32 @@ string toString();
 // Functions called: 
 LinkedListContext();
 
-// Constructor for a head node's keyword and context
+// Constructor for a keyword and its first occurrence
 // X-----------------------X
 // |    #NAME    |
 // X-----------------------X
 // Description:      
-// Parameters:       
+// Parameters:       someKeyword - The keyword
+//                   somePosition - Token position of the occurrence in the archive
+//                   documentID - Document holding the occurrence
+//                   lengthOfPrevContext - Length of the occurrence's previous context string
 // Preconditions:    
 // Postconditions:   
 // Return value:     
 // Functions called: 
-LinkedListContext(string someKeyword, string prevContext, string postContext);
+LinkedListContext(string someKeyword, unsigned int somePosition, unsigned int documentID, int lengthOfPrevContext);
+
+// Move constructor
+// X-----------------------------------------------X
+// |    #LinkedListContext(LinkedListContext&&)    |
+// X-----------------------------------------------X
+// Description:      Takes over another list's keyword and occurrences without copying them
+// Parameters:       someLinkedList - The list to take from, ie. a temporary from ReaderCorpus
+// Preconditions:    
+// Postconditions:   someLinkedList is empty but valid
+// Return value:     
+// Functions called: std::move()
+LinkedListContext(LinkedListContext&& someLinkedList);
 
 // #~LinkedListContext() - Destructor for a LinkedListContext
 // X-----------------------X
@@ -396,17 +620,6 @@ LinkedListContext(string someKeyword, string prevContext, string postContext);
 //
 //-------|---------|---------|---------|---------|---------|---------|---------|
 
-// X-----------------------X
-// |    #NAME    |
-// X-----------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string getPrevContext(const NodeContext* currNodePtr) const;
-
 // X-----------------------X
 // |    #NAME    |
 // X-----------------------X
@@ -418,16 +631,111 @@ string getPrevContext(const NodeContext* currNodePtr) const;
 // Functions called: 
 string getKeyword() const;
 
+// X-----------------------------X
+// |    #getOccurrenceCount()    |
+// X-----------------------------X
+// Description:      Returns the number of occurrences the list holds
+// Return value:     >= 0, at most occurrenceCap when the list is capped
+unsigned int getOccurrenceCount() const;
+
+// X-----------------------------X
+// |    #getOccurrenceTotal()    |
+// X-----------------------------X
+// Description:      Returns the number of occurrences of the keyword read, whether or not the list holds them
+// Return value:     >= getOccurrenceCount()
+unsigned int getOccurrenceTotal() const;
+
 // X-----------------------X
-// |    #NAME    |
+// |    #getPositions()    |
 // X-----------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string getPostContext(const NodeContext* currNodePtr) const;
+// Description:      Returns the token position of every occurrence, in corpus order
+// Return value:     The list's postings, valid until the list is next changed
+const ListPostings& getPositions() const;
+
+// X--------------------------X
+// |    #getFormatLength()    |
+// X--------------------------X
+// Description:      Returns the width previous contexts are right-aligned to
+// Return value:     Length of the longest previous context seen, >= 0
+static int getFormatLength();
+
+// X-------------------------------X
+// |    #widenFormatLength(int)    |
+// X-------------------------------X
+// Description:      Widens the previous-context alignment as an occurrence with that context would
+// Parameters:       someLength - Length of a previous context, ie. one read in an earlier run
+// Postconditions:   Affects every LinkedListContext. Never narrows the alignment.
+// Return value:     None
+// Functions called: None
+static void widenFormatLength(int someLength);
+
+// X---------------------------------X
+// |    #setFixedWidths(int, int)    |
+// X---------------------------------X
+// Description:      Sets both alignment widths once, ahead of any reading, so every line rendered from then
+//                   on is aligned as the last will be. Output can then be written while the corpus is still
+//                   being read, and rendered a list at a time without a pass for the widths.
+// Parameters:       somePrevWidth - Characters of the previous-context column. A longer context keeps its
+//                                   rightmost characters, those nearest the keyword. Below 1 is taken as 1.
+//                   someKeywordWidth - Characters of the keyword column. A longer keyword keeps its first
+//                                      characters. Below 1 is taken as 1.
+// Postconditions:   Affects every LinkedListContext. Neither width is widened again.
+// Return value:     None
+// Functions called: None
+static void setFixedWidths(int somePrevWidth, int someKeywordWidth);
+
+// X-------------------------------X
+// |    #setDocumentFilter(int)    |
+// X-------------------------------X
+// Description:      Restricts toString() to the occurrences of a single document
+// Parameters:       someDocumentID - Document to emit, or -1 to emit all documents
+// Postconditions:   Affects every LinkedListContext
+// Return value:     None
+// Functions called: None
+static void setDocumentFilter(int someDocumentID);
+
+// X-----------------------------------------X
+// |    #setArchive(const ArchiveCorpus*)    |
+// X-----------------------------------------X
+// Description:      Sets the token store that occurrence positions refer to
+// Parameters:       someArchivePtr - The archive filled by the ReaderCorpus
+// Postconditions:   Affects every LinkedListContext
+// Return value:     None
+// Functions called: None
+static void setArchive(const ArchiveCorpus* someArchivePtr);
+
+// X---------------------------------X
+// |    #setCollapseRepeats(bool)    |
+// X---------------------------------X
+// Description:      Chooses whether toString() renders a repeated window once, with its multiplicity
+// Parameters:       isCollapsed - true to collapse repeats, false to render every occurrence
+// Postconditions:   Affects every LinkedListContext
+// Return value:     None
+// Functions called: None
+static void setCollapseRepeats(bool isCollapsed);
+
+// X--------------------------------------X
+// |    #setPhraseLength(unsigned int)    |
+// X--------------------------------------X
+// Description:      Sets how many words every keyword spans
+// Parameters:       someLength - Words per keyword, 1 for single words. 0 is taken as 1.
+// Postconditions:   Affects every LinkedListContext
+// Return value:     None
+// Functions called: None
+static void setPhraseLength(unsigned int someLength);
+
+// X-----------------------------------------------------------X
+// |    #setOccurrenceCap(unsigned int, unsigned long long)    |
+// X-----------------------------------------------------------X
+// Description:      Caps the occurrences each list holds, sampling the rest away
+// Parameters:       someCap - Most occurrences per list, or 0 to hold every occurrence
+//                   someSeed - Seed of the sampling. The same seed and input sample the same occurrences.
+// Preconditions:    No list holds an occurrence yet
+// Postconditions:   Affects every LinkedListContext. Totals stay exact; removeDocument() and expireBefore()
+//                   lower them only by the sampled occurrences they drop.
+// Return value:     None
+// Functions called: None
+static void setOccurrenceCap(unsigned int someCap, unsigned long long someSeed);
 
 
 //-------|---------|---------|---------|---------|---------|---------|---------|
@@ -482,7 +790,20 @@ bool operator==(const LinkedListContext& someLinkedList) const;
 // Postconditions:   
 // Return value:     
 // Functions called: 
-LinkedListContext& operator=(LinkedListContext& someLinkedList);
+LinkedListContext& operator=(const LinkedListContext& someLinkedList);
+
+// #operator=(LinkedListContext&&) - Assignment from a list that is about to be discarded
+// X---------------------------------------X
+// |    #operator=(LinkedListContext&&)    |
+// X---------------------------------------X
+// Description:      As operator=(const LinkedListContext&), appending the occurrences of someLinkedList.
+//                   An empty list takes over someLinkedList's storage outright instead of copying it.
+// Parameters:       someLinkedList - The list to take from
+// Preconditions:    
+// Postconditions:   someLinkedList may be left empty
+// Return value:     This list
+// Functions called: operator=(const LinkedListContext&), std::move()
+LinkedListContext& operator=(LinkedListContext&& someLinkedList);
 
 // #operator<< - 
 // X-----------------------X
@@ -494,7 +815,7 @@ LinkedListContext& operator=(LinkedListContext& someLinkedList);
 // Postconditions:   
 // Return value:     
 // Functions called: 
-friend ostream& operator<<(ostream& coutStream, LinkedListContext& someLinkedList);
+friend ostream& operator<<(ostream& coutStream, const LinkedListContext& someLinkedList);
 
 }; // Closing class LinkedListContext
 
@@ -0,0 +1,381 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for string operations
+#include <string>
+
+// Field and method declarations for the ListPostings class
+#include "ListPostings.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------X
+// |    #encodeGap(unsigned int)    |
+// X--------------------------------X
+// Writes a gap as a varint: low 7 bits first, high bit flags that another byte follows
+void ListPostings::encodeGap(unsigned int someGap) {
+   // Invariant: someGap holds the bits not yet written
+   while (someGap >= 0x80) {
+      encodedBytes.push_back((char)((someGap & 0x7F) | 0x80));
+      someGap = someGap >> 7;
+   }
+   encodedBytes.push_back((char)someGap);
+}
+
+// X---------------------------X
+// |    #decodeGap(size_t&)    |
+// X---------------------------X
+// Reads the varint at byteIndex and advances byteIndex past it
+unsigned int ListPostings::decodeGap(size_t& byteIndex) const {
+   unsigned int retGap = 0;
+   int shift = 0;
+   unsigned char aByte;
+   // Invariant: retGap holds the low 'shift' bits of the gap
+   do {
+      aByte = (unsigned char)encodedBytes[byteIndex];
+      byteIndex++;
+      retGap = retGap | ((unsigned int)(aByte & 0x7F) << shift);
+      shift = shift + 7;
+   } while (aByte & 0x80);
+   return(retGap);
+}
+
+// X-----------------------------------X
+// |    #rewriteFront(unsigned int)    |
+// X-----------------------------------X
+// Rebuilds the buffer as the first live position, now against 0, followed by the live gaps after it
+void ListPostings::rewriteFront(unsigned int someShift) {
+   size_t byteIndex = frontByte;
+   unsigned int firstPosition = frontBase + decodeGap(byteIndex);
+   string laterGaps(encodedBytes, byteIndex, string::npos);
+   encodedBytes.clear();
+   encodeGap(firstPosition - someShift);
+   encodedBytes.append(laterGaps);
+   // A list that has shrunk a long way gives back its spare capacity
+   if (encodedBytes.capacity() > 2 * encodedBytes.size()) {
+      encodedBytes.shrink_to_fit();
+   }
+   frontByte = 0;
+   frontBase = 0;
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------X
+// |    #append(unsigned int)    |
+// X-----------------------------X
+// Adds a position to the end of the list, stored as its gap from the previous one
+void ListPostings::append(unsigned int somePosition) {
+   encodeGap(somePosition - lastPosition);
+   lastPosition = somePosition;
+   postingCount++;
+}
+
+// X---------------------------------------X
+// |    #appendAll(const ListPostings&)    |
+// X---------------------------------------X
+// Concatenates someList onto this list. someList's first gap is relative to 0, so it alone is
+// re-encoded against this list's last position; every later gap is already relative and is copied as-is.
+void ListPostings::appendAll(const ListPostings& someList) {
+   if (someList.postingCount == 0) {
+      return;
+   }
+   size_t byteIndex = someList.frontByte;
+   unsigned int firstPosition = someList.frontBase + someList.decodeGap(byteIndex);
+   encodeGap(firstPosition - lastPosition);
+   encodedBytes.append(someList.encodedBytes, byteIndex, string::npos);
+   lastPosition = someList.lastPosition;
+   postingCount = postingCount + someList.postingCount;
+}
+
+// X---------------------------------X
+// |    #dropBefore(unsigned int)    |
+// X---------------------------------X
+// Advances frontByte past every leading position below someCutoff. Each varint is decoded once on the way
+// out, and the buffer is rewritten only when the dropped bytes reach half of it.
+unsigned int ListPostings::dropBefore(unsigned int someCutoff) {
+   unsigned int droppedCount = 0;
+   // Invariant: frontBase is the last position dropped and frontByte the varint after it
+   while (postingCount > 0) {
+      size_t byteIndex = frontByte;
+      unsigned int nextPosition = frontBase + decodeGap(byteIndex);
+      if (nextPosition >= someCutoff) {
+         break;
+      }
+      frontByte = byteIndex;
+      frontBase = nextPosition;
+      postingCount--;
+      droppedCount++;
+   }
+   if (postingCount == 0) {
+      // Nothing left to keep, so the list starts over
+      string().swap(encodedBytes);
+      lastPosition = 0;
+      frontByte = 0;
+      frontBase = 0;
+   }
+   else if (2 * (size_t)frontByte >= encodedBytes.size()) {
+      rewriteFront(0);
+   }
+   return(droppedCount);
+}
+
+// X-------------------------------X
+// |    #removeAt(unsigned int)    |
+// X-------------------------------X
+// Walks to the position's varint. The last position is cut off the end; any other has its gap added to the
+// next one, so the bytes of both are replaced by one varint and nothing after them is re-encoded.
+void ListPostings::removeAt(unsigned int someIndex) {
+   size_t byteIndex = frontByte;
+   unsigned int prevPosition = frontBase;
+   for (unsigned int i = 0 ; i < someIndex ; i++) {
+      prevPosition = prevPosition + decodeGap(byteIndex);
+   }
+   size_t removedStart = byteIndex;
+   unsigned int removedGap = decodeGap(byteIndex);
+   postingCount--;
+   if (someIndex == postingCount) {
+      encodedBytes.resize(removedStart);
+      lastPosition = prevPosition;
+      if (postingCount == 0) {
+         string().swap(encodedBytes);
+         lastPosition = 0;
+         frontByte = 0;
+         frontBase = 0;
+      }
+      return;
+   }
+   unsigned int mergedGap = removedGap + decodeGap(byteIndex);
+   // Encode the merged gap at the end, then move it over the two varints it replaces
+   size_t bufferEnd = encodedBytes.size();
+   encodeGap(mergedGap);
+   string mergedBytes(encodedBytes, bufferEnd, string::npos);
+   encodedBytes.resize(bufferEnd);
+   encodedBytes.replace(removedStart, byteIndex - removedStart, mergedBytes);
+}
+
+// X--------------------------------X
+// |    #shiftDown(unsigned int)    |
+// X--------------------------------X
+// Later positions are stored as gaps, which a shift leaves alone: only the first is rewritten
+void ListPostings::shiftDown(unsigned int someShift) {
+   if (postingCount == 0) {
+      return;
+   }
+   rewriteFront(someShift);
+   lastPosition = lastPosition - someShift;
+}
+
+// X-------------------X
+// |    #getCount()    |
+// X-------------------X
+// Returns the number of positions in the list
+unsigned int ListPostings::getCount() const {
+   return(postingCount);
+}
+
+// X----------------------X
+// |    #getByteSize()    |
+// X----------------------X
+// Returns the number of encoded bytes
+size_t ListPostings::getByteSize() const {
+   return(encodedBytes.size());
+}
+
+// X--------------------------X
+// |    #getLastPosition()    |
+// X--------------------------X
+// Returns the last position appended
+unsigned int ListPostings::getLastPosition() const {
+   return(lastPosition);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------X
+// |    #ListPostings()    |
+// X-----------------------X
+// Default constructor. Makes an empty list.
+ListPostings::ListPostings() {
+   lastPosition = 0;
+   postingCount = 0;
+   frontByte = 0;
+   frontBase = 0;
+}
@@ -0,0 +1,404 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for string operations (the encoded byte buffer)
+#include <string>
+
+using namespace std;
+
+// X---------------------X
+// |    #ListPostings    |
+// X---------------------X
+// Description: Compressed, append-only list of the token positions at which one keyword occurs.
+//              Positions are stored as gaps from the previous position, each gap written as a
+//              little-endian base-128 varint (7 data bits per byte, high bit set on all but the last byte).
+//              Dense keywords average close to one byte per occurrence, against a heap node per occurrence.
+class ListPostings {
+
+public:
+
+   // X---------------X
+   // |    #Cursor    |
+   // X---------------X
+   // Description: Forward-only decoder over a ListPostings. Holds a byte offset and the last decoded
+   //              position, so sequential iteration costs a few shifts and adds per occurrence.
+   //              Invalidated by any append to the list it reads.
+   class Cursor {
+   private:
+      // #listPtr - The list being decoded
+      const ListPostings* listPtr;
+      // #byteIndex - Offset of the next undecoded varint in listPtr->encodedBytes
+      size_t byteIndex;
+      // #position - Most recently decoded position, the base for the next gap
+      unsigned int position;
+      // #remaining - Occurrences not yet decoded
+      unsigned int remaining;
+
+   public:
+      Cursor(const ListPostings& someList) {
+         listPtr = &someList;
+         byteIndex = someList.frontByte;
+         position = someList.frontBase;
+         remaining = someList.postingCount;
+      }
+
+      // #hasNext() - Reports whether another position can be decoded
+      bool hasNext() const {
+         return(remaining > 0);
+      }
+
+      // #next() - Decodes and returns the next position. Precondition: hasNext()
+      unsigned int next() {
+         position = position + listPtr->decodeGap(byteIndex);
+         remaining--;
+         return(position);
+      }
+   };
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------X
+// |    #encodedBytes    |
+// X---------------------X
+// Description: Varint-encoded gaps, oldest first. A string is used as the byte buffer so that
+//              short lists (one or two occurrences) sit in its small-string storage with no heap block.
+// Invariants:  Holds exactly postingCount complete varints.
+string encodedBytes;
+
+// X---------------------X
+// |    #lastPosition    |
+// X---------------------X
+// Description: Largest position appended so far. The base of the next gap.
+// Invariants:  0 while the list is empty.
+unsigned int lastPosition;
+
+// X---------------------X
+// |    #postingCount    |
+// X---------------------X
+// Description: Number of positions in the list
+// Invariants:  >= 0
+unsigned int postingCount;
+
+// X------------------X
+// |    #frontByte    |
+// X------------------X
+// Description: Offset of the first live varint. The bytes before it encode positions dropped by dropBefore(),
+//              and are discarded once they make up half of encodedBytes.
+// Invariants:  0 while nothing has been dropped since the last discard.
+unsigned int frontByte;
+
+// X------------------X
+// |    #frontBase    |
+// X------------------X
+// Description: Position that the varint at frontByte is a gap from: the last position dropped
+// Invariants:  0 when frontByte is 0.
+unsigned int frontBase;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------X
+// |    #encodeGap(unsigned int)    |
+// X--------------------------------X
+// Description:      Writes a gap to the end of encodedBytes as a varint
+// Parameters:       someGap - Distance from the previous position
+// Preconditions:    None
+// Postconditions:   encodedBytes grows by 1 to 5 bytes
+// Return value:     None
+// Functions called: string::push_back()
+void encodeGap(unsigned int someGap);
+
+// X---------------------------X
+// |    #decodeGap(size_t&)    |
+// X---------------------------X
+// Description:      Reads the varint starting at byteIndex
+// Parameters:       byteIndex - Offset of the varint, advanced past it on return
+// Preconditions:    byteIndex is the start of a complete varint
+// Postconditions:   byteIndex points at the following varint
+// Return value:     The decoded gap
+// Functions called: None
+unsigned int decodeGap(size_t& byteIndex) const;
+
+// X-----------------------------------X
+// |    #rewriteFront(unsigned int)    |
+// X-----------------------------------X
+// Description:      Discards the dropped bytes, re-encoding the first live position (less someShift) against 0
+// Parameters:       someShift - Amount every position is lowered by, 0 to keep them
+// Preconditions:    getCount() > 0 and the first position is at least someShift
+// Postconditions:   frontByte and frontBase are 0. The later gaps are copied unchanged.
+// Return value:     None
+// Functions called: decodeGap(), encodeGap()
+void rewriteFront(unsigned int someShift);
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------X
+// |    #append(unsigned int)    |
+// X-----------------------------X
+// Description:      Adds a position to the end of the list
+// Parameters:       somePosition - Token position of the occurrence
+// Preconditions:    somePosition > the last position appended (corpus order)
+// Postconditions:   getCount() grows by one
+// Return value:     None
+// Functions called: encodeGap()
+void append(unsigned int somePosition);
+
+// X---------------------------------------X
+// |    #appendAll(const ListPostings&)    |
+// X---------------------------------------X
+// Description:      Concatenates another list onto this one. Only the first gap of someList is
+//                   re-encoded; the rest of its bytes are copied verbatim.
+// Parameters:       someList - List whose positions all follow this list's last position
+// Preconditions:    someList is not this list
+// Postconditions:   getCount() grows by someList.getCount()
+// Return value:     None
+// Functions called: decodeGap(), encodeGap(), string::append()
+void appendAll(const ListPostings& someList);
+
+// X---------------------------------X
+// |    #dropBefore(unsigned int)    |
+// X---------------------------------X
+// Description:      Removes the leading positions below a cutoff. The dropped bytes are skipped, not erased,
+//                   until they make up half the buffer, so each position costs O(1) amortized to drop.
+// Parameters:       someCutoff - First position to keep
+// Preconditions:    None
+// Postconditions:   Every position left is >= someCutoff. A list emptied this way appends as a new one.
+// Return value:     Number of positions dropped
+// Functions called: decodeGap(), rewriteFront()
+unsigned int dropBefore(unsigned int someCutoff);
+
+// X-------------------------------X
+// |    #removeAt(unsigned int)    |
+// X-------------------------------X
+// Description:      Removes one position. Its gap and the next one merge into a single varint in place.
+// Parameters:       someIndex - Index of the position, 0 being the first
+// Preconditions:    someIndex < getCount()
+// Postconditions:   getCount() shrinks by one. The other positions keep their order.
+// Return value:     None
+// Functions called: decodeGap(), encodeGap()
+void removeAt(unsigned int someIndex);
+
+// X--------------------------------X
+// |    #shiftDown(unsigned int)    |
+// X--------------------------------X
+// Description:      Lowers every position by the same amount, ie. after the archive discards its oldest tokens
+// Parameters:       someShift - Amount to lower each position by
+// Preconditions:    Every position is >= someShift
+// Postconditions:   Only the first gap is re-encoded. O(bytes held).
+// Return value:     None
+// Functions called: rewriteFront()
+void shiftDown(unsigned int someShift);
+
+// X-------------------X
+// |    #getCount()    |
+// X-------------------X
+// Description:      Returns the number of positions in the list
+// Return value:     >= 0
+unsigned int getCount() const;
+
+// X----------------------X
+// |    #getByteSize()    |
+// X----------------------X
+// Description:      Returns the number of encoded bytes, excluding the object itself
+// Return value:     >= 0
+size_t getByteSize() const;
+
+// X--------------------------X
+// |    #getLastPosition()    |
+// X--------------------------X
+// Description:      Returns the last position appended
+// Preconditions:    getCount() > 0
+// Return value:     A token position
+unsigned int getLastPosition() const;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------X
+// |    #ListPostings()    |
+// X-----------------------X
+// Default constructor. Makes an empty list.
+ListPostings();
+
+}; // Closing class ListPostings
@@ -0,0 +1,817 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Field and method declarations for the RadixTreeGeneric class
+#include "RadixTreeGeneric.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------X
+// |    #makeLeaf(typeD&&)    |
+// X--------------------------X
+template <class typeT, class typeK>
+template <class typeD>
+typename RadixTreeGeneric<typeT, typeK>::LeafRadix* RadixTreeGeneric<typeT, typeK>::makeLeaf(typeD&& someData) {
+   nodeBytes += sizeof(LeafRadix);
+   leafCount++;
+   return(new LeafRadix(std::forward<typeD>(someData)));
+}
+
+// X---------------------X
+// |    #makeInner2()    |
+// X---------------------X
+template <class typeT, class typeK>
+typename RadixTreeGeneric<typeT, typeK>::template InnerSorted<2>* RadixTreeGeneric<typeT, typeK>::makeInner2() {
+   InnerSorted<2>* innerPtr = new InnerSorted<2>;
+   innerPtr->nodeKind = 2;
+   innerPtr->childCount = 0;
+   innerPtr->prefixLength = 0;
+   innerPtr->endLeaf = nullptr;
+   nodeBytes += sizeof(InnerSorted<2>);
+   return(innerPtr);
+}
+
+// X---------------------------X
+// |    #isLeaf(NodeRadix*)    |
+// X---------------------------X
+template <class typeT, class typeK>
+bool RadixTreeGeneric<typeT, typeK>::isLeaf(NodeRadix* nodePtr) {
+   return((reinterpret_cast<uintptr_t>(nodePtr) & 1) != 0);
+}
+
+// X---------------------------X
+// |    #asLeaf(NodeRadix*)    |
+// X---------------------------X
+template <class typeT, class typeK>
+typename RadixTreeGeneric<typeT, typeK>::LeafRadix* RadixTreeGeneric<typeT, typeK>::asLeaf(NodeRadix* nodePtr) {
+   return(reinterpret_cast<LeafRadix*>(reinterpret_cast<uintptr_t>(nodePtr) - 1));
+}
+
+// X----------------------------X
+// |    #tagLeaf(LeafRadix*)    |
+// X----------------------------X
+template <class typeT, class typeK>
+typename RadixTreeGeneric<typeT, typeK>::NodeRadix* RadixTreeGeneric<typeT, typeK>::tagLeaf(LeafRadix* leafPtr) {
+   return(reinterpret_cast<NodeRadix*>(reinterpret_cast<uintptr_t>(leafPtr) + 1));
+}
+
+// X----------------------------------------------------------------X
+// |    #sortedLinks(InnerRadix*, unsigned char*&, NodeRadix**&)    |
+// X----------------------------------------------------------------X
+template <class typeT, class typeK>
+bool RadixTreeGeneric<typeT, typeK>::sortedLinks(InnerRadix* innerPtr, unsigned char*& childBytes, NodeRadix**& childPtrs) {
+   if (innerPtr->nodeKind == 2) {
+      childBytes = static_cast<InnerSorted<2>*>(innerPtr)->childBytes;
+      childPtrs = static_cast<InnerSorted<2>*>(innerPtr)->childPtrs;
+   }
+   else if (innerPtr->nodeKind == 4) {
+      childBytes = static_cast<InnerSorted<4>*>(innerPtr)->childBytes;
+      childPtrs = static_cast<InnerSorted<4>*>(innerPtr)->childPtrs;
+   }
+   else if (innerPtr->nodeKind == 8) {
+      childBytes = static_cast<InnerSorted<8>*>(innerPtr)->childBytes;
+      childPtrs = static_cast<InnerSorted<8>*>(innerPtr)->childPtrs;
+   }
+   else if (innerPtr->nodeKind == 16) {
+      childBytes = static_cast<InnerSorted<16>*>(innerPtr)->childBytes;
+      childPtrs = static_cast<InnerSorted<16>*>(innerPtr)->childPtrs;
+   }
+   else {
+      return(false);
+   }
+   return(true);
+}
+
+// X--------------------------------X
+// |    #growSorted(InnerRadix*)    |
+// X--------------------------------X
+template <class typeT, class typeK>
+template <int sizeN>
+typename RadixTreeGeneric<typeT, typeK>::InnerRadix* RadixTreeGeneric<typeT, typeK>::growSorted(InnerRadix* innerPtr) {
+   InnerSorted<sizeN>* fromPtr = static_cast<InnerSorted<sizeN>*>(innerPtr);
+   InnerSorted<2 * sizeN>* toPtr = new InnerSorted<2 * sizeN>;
+   toPtr->nodeKind = 2 * sizeN;
+   copyHeader(fromPtr, toPtr);
+   for (int i = 0 ; i < sizeN ; i++) {
+      toPtr->childBytes[i] = fromPtr->childBytes[i];
+      toPtr->childPtrs[i] = fromPtr->childPtrs[i];
+   }
+   delete fromPtr;
+   nodeBytes += sizeof(InnerSorted<2 * sizeN>) - sizeof(InnerSorted<sizeN>);
+   return(toPtr);
+}
+
+// X----------------------------------------------X
+// |    #findChild(InnerRadix*, unsigned char)    |
+// X----------------------------------------------X
+template <class typeT, class typeK>
+typename RadixTreeGeneric<typeT, typeK>::NodeRadix** RadixTreeGeneric<typeT, typeK>::findChild(InnerRadix* innerPtr, unsigned char someByte) {
+   unsigned char* childBytes;
+   NodeRadix** childPtrs;
+   if (sortedLinks(innerPtr, childBytes, childPtrs)) {
+      // Bytes are sorted, so the scan can stop at the first larger one
+      for (int i = 0 ; i < innerPtr->childCount && childBytes[i] <= someByte ; i++) {
+         if (childBytes[i] == someByte) {
+            return(&childPtrs[i]);
+         }
+      }
+      return(nullptr);
+   }
+   if (innerPtr->nodeKind == 48) {
+      InnerRadix48* largePtr = static_cast<InnerRadix48*>(innerPtr);
+      if (largePtr->childSlots[someByte] == 0) {
+         return(nullptr);
+      }
+      return(&largePtr->childPtrs[largePtr->childSlots[someByte] - 1]);
+   }
+   InnerRadix256* fullPtr = static_cast<InnerRadix256*>(innerPtr);
+   if (fullPtr->childPtrs[someByte] == nullptr) {
+      return(nullptr);
+   }
+   return(&fullPtr->childPtrs[someByte]);
+}
+
+// X---------------------------------------------------------X
+// |    #addChild(NodeRadix*&, unsigned char, NodeRadix*)    |
+// X---------------------------------------------------------X
+template <class typeT, class typeK>
+void RadixTreeGeneric<typeT, typeK>::addChild(NodeRadix*& nodeRef, unsigned char someByte, NodeRadix* childPtr) {
+   InnerRadix* innerPtr = static_cast<InnerRadix*>(nodeRef);
+   // Grow a full node into the next size up; the old node is freed and nodeRef relinked
+   if (innerPtr->nodeKind == 2 && innerPtr->childCount == 2) {
+      innerPtr = growSorted<2>(innerPtr);
+   }
+   else if (innerPtr->nodeKind == 4 && innerPtr->childCount == 4) {
+      innerPtr = growSorted<4>(innerPtr);
+   }
+   else if (innerPtr->nodeKind == 8 && innerPtr->childCount == 8) {
+      innerPtr = growSorted<8>(innerPtr);
+   }
+   else if (innerPtr->nodeKind == 16 && innerPtr->childCount == 16) {
+      InnerSorted<16>* mediumPtr = static_cast<InnerSorted<16>*>(innerPtr);
+      InnerRadix48* largePtr = new InnerRadix48;
+      largePtr->nodeKind = 48;
+      copyHeader(mediumPtr, largePtr);
+      for (int i = 0 ; i < 256 ; i++) {
+         largePtr->childSlots[i] = 0;
+      }
+      for (int i = 0 ; i < 16 ; i++) {
+         largePtr->childSlots[mediumPtr->childBytes[i]] = i + 1;
+         largePtr->childPtrs[i] = mediumPtr->childPtrs[i];
+      }
+      delete mediumPtr;
+      nodeBytes += sizeof(InnerRadix48) - sizeof(InnerSorted<16>);
+      innerPtr = largePtr;
+   }
+   else if (innerPtr->nodeKind == 48 && innerPtr->childCount == 48) {
+      InnerRadix48* largePtr = static_cast<InnerRadix48*>(innerPtr);
+      InnerRadix256* fullPtr = new InnerRadix256;
+      fullPtr->nodeKind = 256;
+      copyHeader(largePtr, fullPtr);
+      for (int i = 0 ; i < 256 ; i++) {
+         fullPtr->childPtrs[i] = nullptr;
+         if (largePtr->childSlots[i] != 0) {
+            fullPtr->childPtrs[i] = largePtr->childPtrs[largePtr->childSlots[i] - 1];
+         }
+      }
+      delete largePtr;
+      nodeBytes += sizeof(InnerRadix256) - sizeof(InnerRadix48);
+      innerPtr = fullPtr;
+   }
+   nodeRef = innerPtr;
+
+   unsigned char* childBytes;
+   NodeRadix** childPtrs;
+   if (sortedLinks(innerPtr, childBytes, childPtrs)) {
+      // Bytes are kept sorted; shift the larger ones up one place
+      int insertAt = innerPtr->childCount;
+      while (insertAt > 0 && childBytes[insertAt - 1] > someByte) {
+         childBytes[insertAt] = childBytes[insertAt - 1];
+         childPtrs[insertAt] = childPtrs[insertAt - 1];
+         insertAt--;
+      }
+      childBytes[insertAt] = someByte;
+      childPtrs[insertAt] = childPtr;
+   }
+   else if (innerPtr->nodeKind == 48) {
+      // Children are never unlinked, so slots fill in order
+      InnerRadix48* largePtr = static_cast<InnerRadix48*>(innerPtr);
+      largePtr->childPtrs[largePtr->childCount] = childPtr;
+      largePtr->childSlots[someByte] = largePtr->childCount + 1;
+   }
+   else {
+      static_cast<InnerRadix256*>(innerPtr)->childPtrs[someByte] = childPtr;
+   }
+   innerPtr->childCount++;
+}
+
+// X---------------------------------------------X
+// |    #copyHeader(InnerRadix*, InnerRadix*)    |
+// X---------------------------------------------X
+template <class typeT, class typeK>
+void RadixTreeGeneric<typeT, typeK>::copyHeader(InnerRadix* fromPtr, InnerRadix* toPtr) {
+   toPtr->childCount = fromPtr->childCount;
+   toPtr->prefixLength = fromPtr->prefixLength;
+   for (unsigned int i = 0 ; i < maxPrefix ; i++) {
+      toPtr->prefixBytes[i] = fromPtr->prefixBytes[i];
+   }
+   toPtr->endLeaf = fromPtr->endLeaf;
+}
+
+// X--------------------------------X
+// |    #minimumLeaf(NodeRadix*)    |
+// X--------------------------------X
+template <class typeT, class typeK>
+typename RadixTreeGeneric<typeT, typeK>::LeafRadix* RadixTreeGeneric<typeT, typeK>::minimumLeaf(NodeRadix* nodePtr) {
+   while (!isLeaf(nodePtr)) {
+      InnerRadix* innerPtr = static_cast<InnerRadix*>(nodePtr);
+      if (innerPtr->endLeaf != nullptr) {
+         return(innerPtr->endLeaf);
+      }
+      unsigned char* childBytes;
+      NodeRadix** childPtrs;
+      if (sortedLinks(innerPtr, childBytes, childPtrs)) {
+         nodePtr = childPtrs[0];
+      }
+      else if (innerPtr->nodeKind == 48) {
+         InnerRadix48* largePtr = static_cast<InnerRadix48*>(innerPtr);
+         int i = 0;
+         while (largePtr->childSlots[i] == 0) {
+            i++;
+         }
+         nodePtr = largePtr->childPtrs[largePtr->childSlots[i] - 1];
+      }
+      else {
+         InnerRadix256* fullPtr = static_cast<InnerRadix256*>(innerPtr);
+         int i = 0;
+         while (fullPtr->childPtrs[i] == nullptr) {
+            i++;
+         }
+         nodePtr = fullPtr->childPtrs[i];
+      }
+   }
+   return(asLeaf(nodePtr));
+}
+
+// X----------------------------------------------------X
+// |    #prefixMismatch(InnerRadix*, string, size_t)    |
+// X----------------------------------------------------X
+template <class typeT, class typeK>
+unsigned int RadixTreeGeneric<typeT, typeK>::prefixMismatch(InnerRadix* innerPtr, const string& someKey, size_t someDepth) {
+   unsigned int storedLength = innerPtr->prefixLength < maxPrefix ? innerPtr->prefixLength : maxPrefix;
+   unsigned int i = 0;
+   for ( ; i < storedLength ; i++) {
+      if (someDepth + i >= someKey.length() || innerPtr->prefixBytes[i] != (unsigned char)someKey[someDepth + i]) {
+         return(i);
+      }
+   }
+   if (innerPtr->prefixLength > maxPrefix) {
+      const string& leafKey = keyOf(minimumLeaf(innerPtr)->leafData);
+      for ( ; i < innerPtr->prefixLength ; i++) {
+         if (someDepth + i >= someKey.length() || leafKey[someDepth + i] != someKey[someDepth + i]) {
+            return(i);
+         }
+      }
+   }
+   return(innerPtr->prefixLength);
+}
+
+// X---------------------------------------------------------X
+// |    #insertNode(NodeRadix*&, typeD&&, string, size_t)    |
+// X---------------------------------------------------------X
+template <class typeT, class typeK>
+template <class typeD>
+bool RadixTreeGeneric<typeT, typeK>::insertNode(NodeRadix*& nodeRef, typeD&& someData, const string& someKey, size_t someDepth) {
+   if (nodeRef == nullptr) {
+      nodeRef = tagLeaf(makeLeaf(std::forward<typeD>(someData)));
+      return(true);
+   }
+
+   // A leaf: the same key takes the assignment, otherwise both leaves go under a new node
+   // whose path is the bytes the two keys share past someDepth
+   if (isLeaf(nodeRef)) {
+      LeafRadix* oldLeaf = asLeaf(nodeRef);
+      const string& oldKey = keyOf(oldLeaf->leafData);
+      if (oldKey == someKey) {
+         oldLeaf->leafData = std::forward<typeD>(someData);
+         return(false);
+      }
+      size_t splitDepth = someDepth;
+      while (splitDepth < oldKey.length() && splitDepth < someKey.length() && oldKey[splitDepth] == someKey[splitDepth]) {
+         splitDepth++;
+      }
+      InnerSorted<2>* splitPtr = makeInner2();
+      splitPtr->prefixLength = splitDepth - someDepth;
+      for (unsigned int i = 0 ; i < splitPtr->prefixLength && i < maxPrefix ; i++) {
+         splitPtr->prefixBytes[i] = someKey[someDepth + i];
+      }
+      NodeRadix* splitRef = splitPtr;
+      if (oldKey.length() == splitDepth) {
+         splitPtr->endLeaf = oldLeaf;
+      }
+      else {
+         addChild(splitRef, oldKey[splitDepth], tagLeaf(oldLeaf));
+      }
+      bool endsHere = (someKey.length() == splitDepth);
+      unsigned char branchByte = endsHere ? 0 : someKey[splitDepth];
+      LeafRadix* newLeaf = makeLeaf(std::forward<typeD>(someData));
+      if (endsHere) {
+         splitPtr->endLeaf = newLeaf;
+      }
+      else {
+         addChild(splitRef, branchByte, tagLeaf(newLeaf));
+      }
+      nodeRef = splitRef;
+      return(true);
+   }
+
+   // An inner node whose path the key leaves early: split the path at that byte
+   InnerRadix* innerPtr = static_cast<InnerRadix*>(nodeRef);
+   if (innerPtr->prefixLength > 0) {
+      unsigned int matchLength = prefixMismatch(innerPtr, someKey, someDepth);
+      if (matchLength < innerPtr->prefixLength) {
+         InnerSorted<2>* splitPtr = makeInner2();
+         splitPtr->prefixLength = matchLength;
+         for (unsigned int i = 0 ; i < matchLength && i < maxPrefix ; i++) {
+            splitPtr->prefixBytes[i] = innerPtr->prefixBytes[i];
+         }
+         // The old node keeps the path past the branching byte. Bytes beyond the stored ones come from a leaf.
+         unsigned char oldByte;
+         if (innerPtr->prefixLength <= maxPrefix) {
+            oldByte = innerPtr->prefixBytes[matchLength];
+            for (unsigned int i = matchLength + 1 ; i < innerPtr->prefixLength ; i++) {
+               innerPtr->prefixBytes[i - matchLength - 1] = innerPtr->prefixBytes[i];
+            }
+         }
+         else {
+            const string& leafKey = keyOf(minimumLeaf(innerPtr)->leafData);
+            oldByte = leafKey[someDepth + matchLength];
+            for (unsigned int i = 0 ; i < maxPrefix && matchLength + 1 + i < innerPtr->prefixLength ; i++) {
+               innerPtr->prefixBytes[i] = leafKey[someDepth + matchLength + 1 + i];
+            }
+         }
+         innerPtr->prefixLength -= matchLength + 1;
+         NodeRadix* splitRef = splitPtr;
+         addChild(splitRef, oldByte, innerPtr);
+         size_t splitDepth = someDepth + matchLength;
+         bool endsHere = (someKey.length() == splitDepth);
+         unsigned char branchByte = endsHere ? 0 : someKey[splitDepth];
+         LeafRadix* newLeaf = makeLeaf(std::forward<typeD>(someData));
+         if (endsHere) {
+            splitPtr->endLeaf = newLeaf;
+         }
+         else {
+            addChild(splitRef, branchByte, tagLeaf(newLeaf));
+         }
+         nodeRef = splitRef;
+         return(true);
+      }
+      someDepth += innerPtr->prefixLength;
+   }
+
+   // The key ends at this node
+   if (someDepth == someKey.length()) {
+      if (innerPtr->endLeaf != nullptr) {
+         innerPtr->endLeaf->leafData = std::forward<typeD>(someData);
+         return(false);
+      }
+      innerPtr->endLeaf = makeLeaf(std::forward<typeD>(someData));
+      return(true);
+   }
+
+   unsigned char branchByte = someKey[someDepth];
+   NodeRadix** childRef = findChild(innerPtr, branchByte);
+   if (childRef != nullptr) {
+      return(insertNode(*childRef, std::forward<typeD>(someData), someKey, someDepth + 1));
+   }
+   LeafRadix* newLeaf = makeLeaf(std::forward<typeD>(someData));
+   addChild(nodeRef, branchByte, tagLeaf(newLeaf));
+   return(true);
+}
+
+// X-----------------------------------------X
+// |    #traverseNode(NodeRadix*, typeS&)    |
+// X-----------------------------------------X
+template <class typeT, class typeK>
+template <class typeS>
+int RadixTreeGeneric<typeT, typeK>::traverseNode(NodeRadix* nodePtr, typeS& someSink) {
+   if (isLeaf(nodePtr)) {
+      someSink(asLeaf(nodePtr)->leafData);
+      return(1);
+   }
+   InnerRadix* innerPtr = static_cast<InnerRadix*>(nodePtr);
+   int sentCount = 0;
+   // A key that ends here is a prefix of every key below, so it sorts first
+   if (innerPtr->endLeaf != nullptr) {
+      someSink(innerPtr->endLeaf->leafData);
+      sentCount++;
+   }
+   unsigned char* childBytes;
+   NodeRadix** childPtrs;
+   if (sortedLinks(innerPtr, childBytes, childPtrs)) {
+      for (int i = 0 ; i < innerPtr->childCount ; i++) {
+         sentCount += traverseNode(childPtrs[i], someSink);
+      }
+   }
+   else if (innerPtr->nodeKind == 48) {
+      InnerRadix48* largePtr = static_cast<InnerRadix48*>(innerPtr);
+      for (int i = 0 ; i < 256 ; i++) {
+         if (largePtr->childSlots[i] != 0) {
+            sentCount += traverseNode(largePtr->childPtrs[largePtr->childSlots[i] - 1], someSink);
+         }
+      }
+   }
+   else {
+      InnerRadix256* fullPtr = static_cast<InnerRadix256*>(innerPtr);
+      for (int i = 0 ; i < 256 ; i++) {
+         if (fullPtr->childPtrs[i] != nullptr) {
+            sentCount += traverseNode(fullPtr->childPtrs[i], someSink);
+         }
+      }
+   }
+   return(sentCount);
+}
+
+// X-------------------------------X
+// |    #deleteNode(NodeRadix*)    |
+// X-------------------------------X
+template <class typeT, class typeK>
+void RadixTreeGeneric<typeT, typeK>::deleteNode(NodeRadix* nodePtr) {
+   if (isLeaf(nodePtr)) {
+      delete asLeaf(nodePtr);
+      return;
+   }
+   InnerRadix* innerPtr = static_cast<InnerRadix*>(nodePtr);
+   if (innerPtr->endLeaf != nullptr) {
+      delete innerPtr->endLeaf;
+   }
+   unsigned char* childBytes;
+   NodeRadix** childPtrs;
+   if (sortedLinks(innerPtr, childBytes, childPtrs)) {
+      for (int i = 0 ; i < innerPtr->childCount ; i++) {
+         deleteNode(childPtrs[i]);
+      }
+      // Each size is freed through its own type
+      if (innerPtr->nodeKind == 2) {
+         delete static_cast<InnerSorted<2>*>(innerPtr);
+      }
+      else if (innerPtr->nodeKind == 4) {
+         delete static_cast<InnerSorted<4>*>(innerPtr);
+      }
+      else if (innerPtr->nodeKind == 8) {
+         delete static_cast<InnerSorted<8>*>(innerPtr);
+      }
+      else {
+         delete static_cast<InnerSorted<16>*>(innerPtr);
+      }
+   }
+   else if (innerPtr->nodeKind == 48) {
+      InnerRadix48* largePtr = static_cast<InnerRadix48*>(innerPtr);
+      for (int i = 0 ; i < largePtr->childCount ; i++) {
+         deleteNode(largePtr->childPtrs[i]);
+      }
+      delete largePtr;
+   }
+   else {
+      InnerRadix256* fullPtr = static_cast<InnerRadix256*>(innerPtr);
+      for (int i = 0 ; i < 256 ; i++) {
+         if (fullPtr->childPtrs[i] != nullptr) {
+            deleteNode(fullPtr->childPtrs[i]);
+         }
+      }
+      delete fullPtr;
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #insert(<typeT>)    |
+// X------------------------X
+template <class typeT, class typeK>
+bool RadixTreeGeneric<typeT, typeK>::insert(typeT& someData) {
+   return(insertNode(rootPtr, someData, keyOf(someData), 0));
+}
+
+// X--------------------------X
+// |    #insert(<typeT>&&)    |
+// X--------------------------X
+template <class typeT, class typeK>
+bool RadixTreeGeneric<typeT, typeK>::insert(typeT&& someData) {
+   return(insertNode(rootPtr, std::move(someData), keyOf(someData), 0));
+}
+
+// X---------------------X
+// |    #find(string)    |
+// X---------------------X
+template <class typeT, class typeK>
+bool RadixTreeGeneric<typeT, typeK>::find(const string& someKey) {
+   NodeRadix* nodePtr = rootPtr;
+   size_t keyDepth = 0;
+   while (nodePtr != nullptr) {
+      if (isLeaf(nodePtr)) {
+         return(keyOf(asLeaf(nodePtr)->leafData) == someKey);
+      }
+      InnerRadix* innerPtr = static_cast<InnerRadix*>(nodePtr);
+      if (keyDepth + innerPtr->prefixLength > someKey.length()) {
+         return(false);
+      }
+      for (unsigned int i = 0 ; i < innerPtr->prefixLength && i < maxPrefix ; i++) {
+         if (innerPtr->prefixBytes[i] != (unsigned char)someKey[keyDepth + i]) {
+            return(false);
+         }
+      }
+      keyDepth += innerPtr->prefixLength;
+      if (keyDepth == someKey.length()) {
+         return(innerPtr->endLeaf != nullptr && keyOf(innerPtr->endLeaf->leafData) == someKey);
+      }
+      NodeRadix** childRef = findChild(innerPtr, someKey[keyDepth]);
+      nodePtr = (childRef == nullptr) ? nullptr : *childRef;
+      keyDepth++;
+   }
+   return(false);
+}
+
+// X---------------------------------------X
+// |    #traversePrefix(string, typeS&)    |
+// X---------------------------------------X
+template <class typeT, class typeK>
+template <class typeS>
+int RadixTreeGeneric<typeT, typeK>::traversePrefix(const string& somePrefix, typeS& someSink) {
+   NodeRadix* nodePtr = rootPtr;
+   size_t keyDepth = 0;
+   while (nodePtr != nullptr) {
+      if (isLeaf(nodePtr)) {
+         LeafRadix* leafPtr = asLeaf(nodePtr);
+         if (keyOf(leafPtr->leafData).compare(0, somePrefix.length(), somePrefix) != 0) {
+            return(0);
+         }
+         someSink(leafPtr->leafData);
+         return(1);
+      }
+      InnerRadix* innerPtr = static_cast<InnerRadix*>(nodePtr);
+      // Only the part of the path the prefix reaches into has to match
+      size_t checkLength = somePrefix.length() - keyDepth;
+      if (innerPtr->prefixLength < checkLength) {
+         checkLength = innerPtr->prefixLength;
+      }
+      if (checkLength > maxPrefix) {
+         if (keyOf(minimumLeaf(innerPtr)->leafData).compare(keyDepth, checkLength, somePrefix, keyDepth, checkLength) != 0) {
+            return(0);
+         }
+      }
+      else {
+         for (unsigned int i = 0 ; i < checkLength ; i++) {
+            if (innerPtr->prefixBytes[i] != (unsigned char)somePrefix[keyDepth + i]) {
+               return(0);
+            }
+         }
+      }
+      keyDepth += innerPtr->prefixLength;
+      if (keyDepth >= somePrefix.length()) {
+         return(traverseNode(innerPtr, someSink));
+      }
+      NodeRadix** childRef = findChild(innerPtr, somePrefix[keyDepth]);
+      nodePtr = (childRef == nullptr) ? nullptr : *childRef;
+      keyDepth++;
+   }
+   return(0);
+}
+
+// X-------------------X
+// |    #printout()    |
+// X-------------------X
+template <class typeT, class typeK>
+void RadixTreeGeneric<typeT, typeK>::printout() {
+   auto printSink = [](typeT& someData) { cout << someData; };
+   traversePrefix("", printSink);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------X
+// |    #RadixTreeGeneric()    |
+// X---------------------------X
+template <class typeT, class typeK>
+RadixTreeGeneric<typeT, typeK>::RadixTreeGeneric() {
+   rootPtr = nullptr;
+   leafCount = 0;
+   nodeBytes = 0;
+}
+
+// X----------------------------X
+// |    #~RadixTreeGeneric()    |
+// X----------------------------X
+template <class typeT, class typeK>
+RadixTreeGeneric<typeT, typeK>::~RadixTreeGeneric() {
+   if (rootPtr != nullptr) {
+      deleteNode(rootPtr);
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------X
+// |    #getSize()    |
+// X------------------X
+template <class typeT, class typeK>
+int RadixTreeGeneric<typeT, typeK>::getSize() const {
+   return(leafCount);
+}
+
+// X-----------------------X
+// |    #getNodeBytes()    |
+// X-----------------------X
+template <class typeT, class typeK>
+size_t RadixTreeGeneric<typeT, typeK>::getNodeBytes() const {
+   return(nodeBytes);
+}
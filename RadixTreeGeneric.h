@@ -0,0 +1,537 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for input-output operations (printout)
+#include <iostream>
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for std::forward (insertion by rvalue)
+#include <utility>
+
+// Necessary for uintptr_t (tagging the links to leaves)
+#include <cstdint>
+
+// Key policies shared with the BSTGeneric class (KeyIdentity)
+#include "BSTGeneric.h"
+
+using namespace std;
+
+// X-------------------------X
+// |    #RadixTreeGeneric    |
+// X-------------------------X
+// Description: Generic adaptive radix tree (ART) over string keys, an alternative container to BSTGeneric.
+//              Each inner node branches on one key byte and comes in six sizes (2, 4, 8, 16, 48 and 256
+//              children), growing as children are added, so sparse and dense branches both stay compact.
+//              Runs of single-child nodes are collapsed into a prefix on the node below (path compression),
+//              and an entry whose key is unique below some byte hangs there as a leaf (lazy expansion).
+//              A leaf is the entry alone: the link to it is tagged instead of the leaf carrying a header.
+//              A shared stem like "connect" in connect/connected/connecting/connection is walked once per
+//              lookup, rather than re-compared at every level of a binary search tree.
+//              Iteration is in the same byte-wise key order as BSTGeneric with CompareThreeWay.
+//              typeK - Key policy, as for BSTGeneric: maps a const typeT& to its const string& key
+template <class typeT, class typeK = KeyIdentity>
+class RadixTreeGeneric {
+
+protected:
+
+   // #NodeRadix - Common head of every inner node: which kind of node this is. A child link may instead
+   //              point to a leaf, marked by its lowest bit (see isLeaf()); leaves have no head.
+   struct NodeRadix {
+      // #nodeKind - The child capacity of the inner node: 2, 4, 8, 16, 48 or 256
+      unsigned short nodeKind;
+   };
+
+   // #LeafRadix - An entry, and nothing else. Its key is read back through keyOf, never stored twice.
+   struct LeafRadix {
+      typeT leafData;
+
+      LeafRadix(typeT& someData) {
+         leafData = someData;
+      }
+
+      LeafRadix(typeT&& someData) : leafData(std::move(someData)) {
+      }
+   };
+
+   // #InnerRadix - Fields shared by the six inner node sizes
+   struct InnerRadix : NodeRadix {
+      // #childCount - Number of children linked
+      unsigned short childCount;
+      // #prefixLength - Length of the compressed path: key bytes every entry below shares past this node's depth
+      unsigned int prefixLength;
+      // #prefixBytes - The first prefixLength bytes of the path, up to maxPrefix. Longer paths are checked
+      //                against a leaf's key (optimistic path compression).
+      unsigned char prefixBytes[8];
+      // #endLeaf - Entry whose key ends exactly after the prefix, ie. "connect" above "connected"
+      LeafRadix* endLeaf;
+   };
+
+   // #InnerSorted - Up to sizeN (2, 4, 8 or 16) children, with their key bytes kept sorted side by side.
+   //                Most branches split only two ways, so the smallest sizes carry most of the tree.
+   template <int sizeN>
+   struct InnerSorted : InnerRadix {
+      unsigned char childBytes[sizeN];
+      NodeRadix* childPtrs[sizeN];
+   };
+
+   // #InnerRadix48 - Up to 48 children, with a 256-entry index from key byte to child slot + 1 (0 for none)
+   struct InnerRadix48 : InnerRadix {
+      unsigned char childSlots[256];
+      NodeRadix* childPtrs[48];
+   };
+
+   // #InnerRadix256 - One child pointer per key byte
+   struct InnerRadix256 : InnerRadix {
+      NodeRadix* childPtrs[256];
+   };
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------X
+// |    #maxPrefix    |
+// X------------------X
+// Number of path bytes an inner node stores itself.
+// Invariant information: Equals the length of InnerRadix::prefixBytes
+static const unsigned int maxPrefix = 8;
+
+// X----------------X
+// |    #rootPtr    |
+// X----------------X
+// Root node: nullptr when empty, a lone leaf, or an inner node.
+// Invariant information: 
+NodeRadix* rootPtr;
+
+// X------------------X
+// |    #leafCount    |
+// X------------------X
+// Number of entries.
+// Invariant information: 
+int leafCount;
+
+// X------------------X
+// |    #nodeBytes    |
+// X------------------X
+// Bytes allocated for nodes, leaves included (the entries' own heap storage excluded).
+// Invariant information: 
+size_t nodeBytes;
+
+// X--------------X
+// |    #keyOf    |
+// X--------------X
+// Key policy instance.
+// Invariant information: 
+typeK keyOf;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// #makeLeaf(typeD&&) - Helper method
+// X--------------------------X
+// |    #makeLeaf(typeD&&)    |
+// X--------------------------X
+// Description:      Allocates a leaf holding someData, copied or moved
+// Return value:     The leaf
+// Functions called: std::forward()
+template <class typeD>
+LeafRadix* makeLeaf(typeD&& someData);
+
+// #makeInner2() - Helper method
+// X---------------------X
+// |    #makeInner2()    |
+// X---------------------X
+// Description:      Allocates an empty 2-child inner node with no prefix
+// Return value:     The node
+InnerSorted<2>* makeInner2();
+
+// #isLeaf(NodeRadix*), #asLeaf(NodeRadix*), #tagLeaf(LeafRadix*) - Helper methods
+// X---------------------------X
+// |    #isLeaf(NodeRadix*)    |
+// X---------------------------X
+// Description:      Tell a child link to a leaf from one to an inner node, and convert between the two.
+//                   Nodes are allocated at least 2-byte aligned, so the lowest bit of a link is free to mark a leaf.
+// Parameters:       nodePtr - A child link, or the root
+//                   leafPtr - A leaf to link
+// Return value:     Whether the link is a leaf; the leaf it links; the tagged link
+static bool isLeaf(NodeRadix* nodePtr);
+static LeafRadix* asLeaf(NodeRadix* nodePtr);
+static NodeRadix* tagLeaf(LeafRadix* leafPtr);
+
+// #sortedLinks(InnerRadix*, unsigned char*&, NodeRadix**&) - Helper method
+// X----------------------------------------------------------------X
+// |    #sortedLinks(InnerRadix*, unsigned char*&, NodeRadix**&)    |
+// X----------------------------------------------------------------X
+// Description:      Finds the sorted byte and link arrays of a 2, 4, 8 or 16-child node
+// Parameters:       innerPtr - The node
+//                   childBytes, childPtrs - Receive the node's arrays
+// Return value:     false for a 48 or 256-child node, which keeps its children otherwise
+bool sortedLinks(InnerRadix* innerPtr, unsigned char*& childBytes, NodeRadix**& childPtrs);
+
+// #growSorted(InnerRadix*) - Helper method
+// X--------------------------------X
+// |    #growSorted(InnerRadix*)    |
+// X--------------------------------X
+// Description:      Replaces a full sizeN-child node (2, 4 or 8) by a node twice the size with the same children
+// Parameters:       innerPtr - The node, freed
+// Return value:     The new node
+// Functions called: copyHeader()
+template <int sizeN>
+InnerRadix* growSorted(InnerRadix* innerPtr);
+
+// #findChild(InnerRadix*, unsigned char) - Helper method
+// X----------------------------------------------X
+// |    #findChild(InnerRadix*, unsigned char)    |
+// X----------------------------------------------X
+// Description:      Finds the child link of an inner node for one key byte
+// Parameters:       innerPtr - The node
+//                   someByte - Key byte at the node's branching depth
+// Return value:     Address of the child pointer, or nullptr if there is no such child
+// Functions called: sortedLinks()
+NodeRadix** findChild(InnerRadix* innerPtr, unsigned char someByte);
+
+// #addChild(NodeRadix*&, unsigned char, NodeRadix*) - Helper method
+// X---------------------------------------------------------X
+// |    #addChild(NodeRadix*&, unsigned char, NodeRadix*)    |
+// X---------------------------------------------------------X
+// Description:      Links a child under a byte the node does not branch on yet, first replacing a full
+//                   node by the next size up (2 to 4 to 8 to 16 to 48 to 256)
+// Parameters:       nodeRef - Link to the inner node, rewritten if the node grows
+//                   someByte - Key byte of the new child
+//                   childPtr - The child
+// Postconditions:   findChild(someByte) is childPtr
+// Functions called: growSorted(), sortedLinks(), copyHeader()
+void addChild(NodeRadix*& nodeRef, unsigned char someByte, NodeRadix* childPtr);
+
+// #copyHeader(InnerRadix*, InnerRadix*) - Helper method
+// X---------------------------------------------X
+// |    #copyHeader(InnerRadix*, InnerRadix*)    |
+// X---------------------------------------------X
+// Description:      Copies the shared inner fields (count, prefix, endLeaf) from one node to another
+void copyHeader(InnerRadix* fromPtr, InnerRadix* toPtr);
+
+// #minimumLeaf(NodeRadix*) - Recursive method
+// X--------------------------------X
+// |    #minimumLeaf(NodeRadix*)    |
+// X--------------------------------X
+// Description:      Returns the leaf with the smallest key below a node. Every leaf below an inner node
+//                   carries the node's full prefix, so this is where prefix bytes past maxPrefix are read.
+// Return value:     A leaf
+LeafRadix* minimumLeaf(NodeRadix* nodePtr);
+
+// #prefixMismatch(InnerRadix*, string, size_t) - Helper method
+// X----------------------------------------------------X
+// |    #prefixMismatch(InnerRadix*, string, size_t)    |
+// X----------------------------------------------------X
+// Description:      Compares a node's compressed path with a key from some depth on
+// Parameters:       innerPtr - The node
+//                   someKey - The key
+//                   someDepth - Key index the path starts at
+// Return value:     Index of the first path byte that differs or lies past the key's end, or prefixLength
+// Functions called: minimumLeaf()
+unsigned int prefixMismatch(InnerRadix* innerPtr, const string& someKey, size_t someDepth);
+
+// #insertNode(NodeRadix*&, typeD&&, string, size_t) - Recursive method
+// X---------------------------------------------------------X
+// |    #insertNode(NodeRadix*&, typeD&&, string, size_t)    |
+// X---------------------------------------------------------X
+// Description:      Inserts someData below nodeRef, splitting a leaf or a compressed path where the key
+//                   diverges. An existing key has someData assigned onto its entry, as in BSTGeneric.
+// Parameters:       nodeRef - Link to the subtree, rewritten when the subtree's top node changes
+//                   someData - typeT lvalue (copied) or rvalue (moved), forwarded exactly once
+//                   someKey - keyOf(someData). Not read once someData has been forwarded.
+//                   someDepth - Number of key bytes consumed above nodeRef
+// Return value:     true if a new entry was made
+// Functions called: insertNode(), makeLeaf(), makeInner2(), addChild(), prefixMismatch()
+template <class typeD>
+bool insertNode(NodeRadix*& nodeRef, typeD&& someData, const string& someKey, size_t someDepth);
+
+// #traverseNode(NodeRadix*, typeS&) - Recursive method
+// X-----------------------------------------X
+// |    #traverseNode(NodeRadix*, typeS&)    |
+// X-----------------------------------------X
+// Description:      Hands every entry below a node to someSink in key order: the node's endLeaf first,
+//                   then its children by ascending byte
+// Return value:     Number of entries sent to someSink
+template <class typeS>
+int traverseNode(NodeRadix* nodePtr, typeS& someSink);
+
+// #deleteNode(NodeRadix*) - Recursive method
+// X-------------------------------X
+// |    #deleteNode(NodeRadix*)    |
+// X-------------------------------X
+// Description:      Frees a node and everything below it
+void deleteNode(NodeRadix* nodePtr);
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #insert(<typeT>)    |
+// X------------------------X
+// Description:      Inserts a copy of someData, or assigns it onto the entry with the same key
+// Return value:     true if a new entry was made
+// Functions called: insertNode()
+bool insert(typeT& someData);
+
+// X--------------------------X
+// |    #insert(<typeT>&&)    |
+// X--------------------------X
+// Description:      As insert(typeT&), but moves someData into the tree
+// Return value:     true if a new entry was made
+// Functions called: insertNode()
+bool insert(typeT&& someData);
+
+// X---------------------X
+// |    #find(string)    |
+// X---------------------X
+// Description:      Reports whether an entry has the given key. Inner nodes are matched on their stored
+//                   bytes only; the leaf reached settles it with one full comparison.
+// Parameters:       someKey - The key
+// Return value:     true if present
+// Functions called: findChild()
+bool find(const string& someKey);
+
+// X---------------------------------------X
+// |    #traversePrefix(string, typeS&)    |
+// X---------------------------------------X
+// Description:      Streams every entry whose key starts with a prefix, in order. The prefix is walked
+//                   down once; the subtree it lands on is exactly the matches. "" streams every entry.
+// Parameters:       somePrefix - Leading bytes to match
+//                   someSink - Callable taking a typeT&
+// Return value:     Number of entries sent to someSink
+// Functions called: traverseNode(), findChild(), minimumLeaf()
+template <class typeS>
+int traversePrefix(const string& somePrefix, typeS& someSink);
+
+// X-------------------X
+// |    #printout()    |
+// X-------------------X
+// Description:      Sends every entry to cout in key order, as BSTGeneric::printout() does
+// Functions called: traverseNode()
+void printout();
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------X
+// |    #RadixTreeGeneric()    |
+// X---------------------------X
+// Default constructor. Makes an empty tree.
+RadixTreeGeneric();
+
+// X----------------------------X
+// |    #~RadixTreeGeneric()    |
+// X----------------------------X
+// Destructor. Frees every node.
+~RadixTreeGeneric();
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------X
+// |    #getSize()    |
+// X------------------X
+// Description:      Returns the number of entries
+// Return value:     >= 0
+int getSize() const;
+
+// X-----------------------X
+// |    #getNodeBytes()    |
+// X-----------------------X
+// Description:      Returns the bytes allocated for nodes and leaves, excluding heap storage owned by the entries
+// Return value:     >= 0
+size_t getNodeBytes() const;
+
+}; // Closing class RadixTreeGeneric
@@ -163,9 +163,12 @@
 // Necessary for file stream operations
 #include <fstream>
 
-// Necessary for string lowercasing operations
+// Necessary for min() (sizing a followed file's reads)
 #include <algorithm>
 
+// Necessary for tolower() and isspace() (cleaning words, splitting a followed file's new text)
+#include <cctype>
+
 // Field and method declarations for the ReaderCorpus class
 #include "ReaderCorpus.h"
 
@@ -249,82 +252,33 @@ bool ReaderCorpus::isFinished() {
    }
 }
 
-// #trimPreNoise(string) - 
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string ReaderCorpus::trimPreNoise(string aWord) {
-   bool firstLetter = false;
-   // Load the first character of the string
-   int currIndex = 0;
-   char currLetter = aWord[currIndex];
-   // Fencepost check. If it's the first actual letter, do nothing
-   if ( 'a' <= currLetter && currLetter <= 'z') {
-      // cout << "This is the first letter! " << currLetter << endl; // DEBUG
-      firstLetter = true;
-   }
-   // Otherwise, the first character is noisy, so proceed forward...
-   else {
-      // While we haven't found the first letter of the word...
-      while (firstLetter == false) {
-         // Increment the index
-         currIndex++;
-         // And check for a valid letter
-         currLetter = aWord[currIndex];
-         if ( 'a' <= currLetter && currLetter <= 'z') {
-            // If we found it, set the exit flag
-            firstLetter = true;
-         } // Closing if
-      } // Closing while loop. First character found and currIndex points to it
-   // Delete the substring from the start to the first index
-   aWord.erase(0, (currIndex));
-   }
-   return(aWord);
-}
-
-// #trimPostNoise(string) - 
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string ReaderCorpus::trimPostNoise(string aWord) {
-   bool lastLetter = false;
-   // Load the last character of the string
-   int currIndex = aWord.length();
-   char currLetter = aWord[currIndex];
-   // Fencepost check. If it's the last actual letter, do nothing
-   if ( 'a' <= currLetter && currLetter <= 'z') {
-      // cout << "This is the last letter! " << currLetter << endl; // DEBUG
-      lastLetter = true;
-   }
-   // Otherwise, the last character is noisy, so proceed backward...
-   else {
-      // While we haven't found the last letter of the word...
-      while (lastLetter == false) {
-         // Decrement the index
-         currIndex--;
-         // And check for a valid letter
-         currLetter = aWord[currIndex];
-         if ( 'a' <= currLetter && currLetter <= 'z') {
-            // If we found it, set the exit flag
-            lastLetter = true;
-         } // Closing if
-      } // Closing while loop. Last character found and currIndex points to it
-   // Delete the substring from the currIndex to the end
-   aWord.erase((currIndex+1), (aWord.length()));
+// X---------------------------X
+// |    #cleanWord(string&)    |
+// X---------------------------X
+// Lowercases a chunk and, if it holds a letter, trims the noise from both ends. A single in-place pass
+// finds both end letters, so a chunk costs one scan and at most two erases, with no copies.
+bool ReaderCorpus::cleanWord(string& aWord) {
+   // Lowercase the word pulled, noting where its first and last letters lie
+   unsigned int wordLength = aWord.length();
+   unsigned int firstLetter = wordLength;
+   unsigned int lastLetter = 0;
+   for (unsigned int i = 0 ; i < wordLength ; i++) {
+      char currChar = (char)tolower((unsigned char)aWord[i]);
+      aWord[i] = currChar;
+      if ('a' <= currChar && currChar <= 'z') {
+         if (firstLetter == wordLength) {
+            firstLetter = i;
+         }
+         lastLetter = i;
+      }
+   } // Word scanned. Is it valid?
+   if (firstLetter == wordLength) {
+      return(false);
    }
-   return(aWord);
+   // Omit post-noisy, then pre-noisy characters
+   aWord.erase(lastLetter + 1);
+   aWord.erase(0, firstLetter);
+   return(true);
 }
 
 
@@ -361,8 +315,9 @@ bool ReaderCorpus::advance() {
       return(false);
    }
    // Shuffle context words down one index
-   for (int i = 0 ; i < 11 ; i++) {
+   for (int i = 0 ; i < 10 ; i++) {
       contextWords[i] = contextWords[i+1];
+      contextPositions[i] = contextPositions[i+1];
    }
    string nextWord = "foobarbaz";
    bool validWord = false;
@@ -371,22 +326,9 @@ bool ReaderCorpus::advance() {
       // Attempt to assign the next whitespace delimited chars to nextWord
       fileObj >> nextWord;
       // cout << "The word just pulled was: " << nextWord << endl; // DEBUG
-      // Lowercase the word pulled
-      // From https://notfaq.wordpress.com/2007/08/04/cc-convert-string-to-upperlower-case/
-      transform(nextWord.begin(), nextWord.end(), nextWord.begin(), ::tolower);
-      // Check to see if valid chars are in the word
-      bool validChars = false;
-      for (unsigned int i = 0 ; i < nextWord.length() ; i++) {
-         if (nextWord[i] >= 'a' && nextWord[i] <= 'z') {
-            validChars = true;
-         }
-      } // Word scanned. Is it valid?
-      validWord = validChars;
+      // Lowercase and trim it, checking that valid chars are in the word
+      validWord = this->cleanWord(nextWord);
    } // Closing while loop, a valid word has been identified OR we've run off the end of the document.
-   // Omit pre-noisy characters
-   nextWord = this->trimPreNoise(nextWord);
-   // Omit post-noisy characters
-   nextWord = this->trimPostNoise(nextWord);
    // If no change was made by the fileObj extraction operator...
    if (nextWord == "foobarbaz") {
       // Default to a whitespace
@@ -394,6 +336,10 @@ bool ReaderCorpus::advance() {
    }
    // Load the next word to the end of the context array
    contextWords[10] = nextWord;
+   // And record it in the archive, unless it is the end-of-document filler
+   if (nextWord != " " && archivePtr != nullptr) {
+      contextPositions[10] = archivePtr->append(nextWord);
+   }
    // cout << "The current word is: " << contextWords[5] << endl; // DEBUG
    // Update the context strings
    string update = "";
@@ -410,6 +356,11 @@ bool ReaderCorpus::advance() {
    postContext = update;
    // Update the current keyword
    currWord = contextWords[5];
+   // If this document has drained and another is queued, cross the boundary now so that
+   // the caller never sees the filler word and the next context starts empty
+   if (currWord == " " && !documentQueue.empty()) {
+      this->openNextDocument();
+   }
    return(true);
 }
 
@@ -439,16 +390,152 @@ bool ReaderCorpus::isPrimed() {
 // Return value:     
 // Functions called: 
 bool ReaderCorpus::loadFile(string fileAddy) {
+   // A document is already loaded, so queue this one behind it
+   if (fileObj.is_open() || !documentQueue.empty()) {
+      ifstream probeObj(fileAddy);
+      if (!probeObj) {
+         cout << "Unable to open Corpus " << fileAddy << ". Skipping..." << endl;
+         return(false);
+      }
+      documentQueue.push_back(fileAddy);
+      return(true);
+   }
    fileObj.open(fileAddy);
    // Confirm that file was opened. Report otherwise if not.
    if (!fileObj) {
       cout << "Unable to open Corpus. Closing program...";
       return(false);
    }
+   // The first document begins here
+   if (archivePtr != nullptr) {
+      archivePtr->beginDocument();
+   }
    // cout << "File loaded successfully to ReaderCorpus object!" << endl; // DEBUG
    return(true);
 }
 
+// X-----------------------X
+// |    #resume(string)    |
+// X-----------------------X
+// Opens a file as the continuation of the archive's last document. No document is begun, and the
+// window is seeded as if that document's last five words had just been read.
+bool ReaderCorpus::resume(string fileAddy) {
+   fileObj.open(fileAddy);
+   if (!fileObj) {
+      cout << "Unable to open Corpus " << fileAddy << "." << endl;
+      return(false);
+   }
+   documentID = archivePtr->getDocumentCount() - 1;
+   this->resetWindow();
+   unsigned int documentStart = archivePtr->getDocumentStart(documentID);
+   unsigned int tokenCount = archivePtr->getTokenCount();
+   // Invariant: slot 10 - i holds the word i positions before the end. Slots before the document start stay empty.
+   for (unsigned int i = 0 ; i < 5 ; i++) {
+      if (tokenCount >= documentStart + i + 1) {
+         contextWords[10 - i] = archivePtr->getWord(tokenCount - i - 1);
+         contextPositions[10 - i] = tokenCount - i - 1;
+      }
+   }
+   resumePending = true;
+   return(true);
+}
+
+// X-----------------------X
+// |    #follow(string)    |
+// X-----------------------X
+// Opens a growing file as a new document, to be read piecewise by readAppended()
+bool ReaderCorpus::follow(string fileAddy) {
+   fileObj.open(fileAddy, ios::binary);
+   if (!fileObj) {
+      cout << "Unable to open Corpus " << fileAddy << "." << endl;
+      return(false);
+   }
+   documentID = archivePtr->beginDocument();
+   followOffset = 0;
+   partialWord = "";
+   return(true);
+}
+
+// X---------------------------X
+// |    #readAppended(bool)    |
+// X---------------------------X
+// Reads from followOffset to the file's current end in 64 KiB blocks, splitting on whitespace as the
+// extraction operator does. The word cut off by the end of the block carries over to the next block or call.
+unsigned int ReaderCorpus::readAppended(bool flushPartial) {
+   // Clear the EOF state of the last read, then measure the file as it stands now
+   fileObj.clear();
+   fileObj.seekg(0, ios::end);
+   streamoff fileLength = fileObj.tellg();
+   if (fileLength < followOffset) {
+      followOffset = 0;
+      partialWord = "";
+      documentID = archivePtr->beginDocument();
+   }
+   fileObj.seekg(followOffset);
+   unsigned int wordsRead = 0;
+   char readBlock[65536];
+   while (followOffset < fileLength) {
+      fileObj.read(readBlock, min((streamoff)sizeof(readBlock), fileLength - followOffset));
+      streamsize blockLength = fileObj.gcount();
+      if (blockLength <= 0) {
+         break;
+      }
+      followOffset = followOffset + blockLength;
+      for (streamsize i = 0 ; i < blockLength ; i++) {
+         if (!isspace((unsigned char)readBlock[i])) {
+            partialWord.push_back(readBlock[i]);
+         }
+         else if (!partialWord.empty()) {
+            if (this->cleanWord(partialWord)) {
+               archivePtr->append(partialWord);
+               wordsRead++;
+            }
+            partialWord.clear();
+         }
+      }
+   }
+   if (flushPartial && !partialWord.empty()) {
+      if (this->cleanWord(partialWord)) {
+         archivePtr->append(partialWord);
+         wordsRead++;
+      }
+      partialWord.clear();
+   }
+   return(wordsRead);
+}
+
+// X--------------------------X
+// |    #readWord(string&)    |
+// X--------------------------X
+// Extracts and cleans chunks until one is a word, opening the next queued document whenever one drains
+bool ReaderCorpus::readWord(string& someWord) {
+   while (true) {
+      if (fileObj >> someWord) {
+         if (this->cleanWord(someWord)) {
+            return(true);
+         }
+      }
+      else if (documentQueue.empty()) {
+         return(false);
+      }
+      else {
+         this->openQueuedFile();
+      }
+   }
+}
+
+// X-------------------------------------X
+// |    #shiftPositions(unsigned int)    |
+// X-------------------------------------X
+// Lowers every window position by someShift. Empty and filler slots hold no position worth keeping.
+void ReaderCorpus::shiftPositions(unsigned int someShift) {
+   for (int i = 0 ; i < 11 ; i++) {
+      if (contextWords[i] != "" && contextWords[i] != " ") {
+         contextPositions[i] = contextPositions[i] - someShift;
+      }
+   }
+}
+
 // X------------------X
 // |    #NAME    |
 // X------------------X
@@ -458,9 +545,8 @@ bool ReaderCorpus::loadFile(string fileAddy) {
 // Postconditions:   
 // Return value:     
 // Functions called: 
-LinkedListContext* ReaderCorpus::makeLinkedListContext() {
-   LinkedListContext* retList = new LinkedListContext(prevContext, contextWords[5], postContext);
-   return(retList);
+LinkedListContext ReaderCorpus::makeLinkedListContext() {
+   return(LinkedListContext(contextWords[5], contextPositions[5], documentID, prevContext.length()));
 }
 
 // #prime() - Advances the reader to the first valid keyword-context state.
@@ -474,12 +560,75 @@ LinkedListContext* ReaderCorpus::makeLinkedListContext() {
 // Return value:     
 // Functions called: 
 string ReaderCorpus::prime() {
+   // After resume() the seeded tail sits in slots 6 to 10. Five reads move it into the previous context
+   // and a sixth brings the first new word to the centre. The filler cannot reach the centre any sooner.
+   if (resumePending) {
+      resumePending = false;
+      for (int i = 0 ; i < 6 && !this->isFinished() ; i++) {
+         this->advance();
+      }
+      return(contextWords[5]);
+   }
    while (!isPrimed()) {
       this->advance();
    }
    return(contextWords[5]);
 }
 
+// X--------------------------X
+// |    #openNextDocument()    |
+// X--------------------------X
+// Description:      Closes the drained document, opens the next queued one and primes the reader on it.
+//                   Clearing the window here is what keeps one document's words out of another's contexts.
+// Parameters:       None
+// Preconditions:    documentQueue is not empty
+// Postconditions:   currWord is the first word of the next non-empty document, or " " if none remain
+// Return value:     None
+// Functions called: resetWindow(), prime()
+void ReaderCorpus::openNextDocument() {
+   this->openQueuedFile();
+   this->resetWindow();
+   // An empty document primes straight onto the filler, which crosses the next boundary in turn
+   this->prime();
+}
+
+// X-------------------------X
+// |    #openQueuedFile()    |
+// X-------------------------X
+// Description:      Closes the drained document and opens the next queued one
+// Parameters:       None
+// Preconditions:    documentQueue is not empty
+// Postconditions:   The archive, if set, has begun the new document
+// Return value:     None
+// Functions called: ArchiveCorpus::beginDocument()
+void ReaderCorpus::openQueuedFile() {
+   fileObj.close();
+   // Clear the EOF/fail state left behind by the previous document
+   fileObj.clear();
+   fileObj.open(documentQueue.front());
+   documentQueue.erase(documentQueue.begin());
+   documentID++;
+   if (archivePtr != nullptr) {
+      archivePtr->beginDocument();
+   }
+}
+
+// X---------------------X
+// |    #resetWindow()    |
+// X---------------------X
+// Description:      Empties the 11-word context window
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   isPrimed() is false
+// Return value:     None
+// Functions called: None
+void ReaderCorpus::resetWindow() {
+   for (int i = 0 ; i < 11 ; i++) {
+      contextWords[i] = "";
+   }
+   currWord = "";
+}
+
 
 
 //-------|---------|---------|---------|---------|---------|---------|---------|
@@ -502,8 +651,13 @@ ReaderCorpus::ReaderCorpus() {
    prevContext = "Nothing to see here!";
    currWord = "De nada";
    postContext = "Nor here!";
+   documentID = 0;
+   archivePtr = nullptr;
+   resumePending = false;
+   followOffset = 0;
    for (int i = 0 ; i < 11 ; i++) {
       contextWords[i] = "";
+      contextPositions[i] = 0;
    }
 }
 
@@ -570,3 +724,42 @@ string ReaderCorpus::getCurrWord() {
 string ReaderCorpus::getPostContext() {
    return(postContext);
 }
+
+// X------------------------X
+// |    #getDocumentID()    |
+// X------------------------X
+// Description:      Returns the document the current word was read from
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     0-based index in loadFile() order
+// Functions called: None
+unsigned int ReaderCorpus::getDocumentID() {
+   return(documentID);
+}
+
+// X--------------------------X
+// |    #getCurrPosition()    |
+// X--------------------------X
+// Description:      Returns the archive token position of the current word
+// Parameters:       None
+// Preconditions:    setArchive() was called before loadFile()
+// Postconditions:   None
+// Return value:     A token position
+// Functions called: None
+unsigned int ReaderCorpus::getCurrPosition() {
+   return(contextPositions[5]);
+}
+
+// X-----------------------------------X
+// |    #setArchive(ArchiveCorpus*)    |
+// X-----------------------------------X
+// Description:      Sets the token store that every word read is appended to
+// Parameters:       someArchivePtr - Archive owned by the caller, outliving this reader
+// Preconditions:    Called before loadFile()
+// Postconditions:   None
+// Return value:     None
+// Functions called: None
+void ReaderCorpus::setArchive(ArchiveCorpus* someArchivePtr) {
+   archivePtr = someArchivePtr;
+}
@@ -165,9 +165,15 @@
 // Necessary for file stream operations
 // #include <fstream> // Disincluded from the .h - No file stream operations here
 
+// Necessary for vector operations (queued documents)
+#include <vector>
+
 // Field and method declarations for the LinkedListContext class
 #include "LinkedListContext.h"
 
+// Token store that every word read is appended to
+#include "ArchiveCorpus.h"
+
 using namespace std;
 
 // X---------------------X
@@ -190,6 +196,13 @@ private:
 // Invariants:  
 string contextWords[11];
 
+// X-------------------------X
+// |    #contextPositions    |
+// X-------------------------X
+// Description: Archive token position of each word in contextWords, shifted alongside it.
+// Invariants:  Meaningful only where contextWords holds a real word (not "" or the " " filler).
+unsigned int contextPositions[11];
+
 // X-----------------X
 // |    #NAME    |
 // X-----------------X
@@ -218,6 +231,50 @@ string postContext;
 // Invariants:  
 ifstream fileObj;
 
+// X----------------------X
+// |    #documentQueue    |
+// X----------------------X
+// Description: File addresses loaded after the first, read in order once the current document drains.
+// Invariants:  Front of the vector is the next document to be opened.
+vector<string> documentQueue;
+
+// X-------------------X
+// |    #documentID    |
+// X-------------------X
+// Description: Index of the document currently being read, in loadFile() order.
+// Invariants:  0 for the first document, increases by one per document boundary.
+unsigned int documentID;
+
+// X-------------------X
+// |    #archivePtr    |
+// X-------------------X
+// Description: Token store that receives every word read, in corpus order. Owned by the caller.
+// Invariants:  May be nullptr, in which case no positions are recorded.
+ArchiveCorpus* archivePtr;
+
+// X----------------------X
+// |    #resumePending    |
+// X----------------------X
+// Description: Set by resume(). The window holds the previous run's tail, so the next prime() reads
+//              five words of look-ahead past it rather than stopping at the first non-empty slot.
+// Invariants:  false once prime() has run.
+bool resumePending;
+
+// X---------------------X
+// |    #followOffset    |
+// X---------------------X
+// Description: Byte offset in the followed file up to which text has been read (see follow())
+// Invariants:  Never beyond the file's length, except when the file was truncated since the last read.
+streamoff followOffset;
+
+// X--------------------X
+// |    #partialWord    |
+// X--------------------X
+// Description: Characters read from the followed file since its last whitespace. The writer may still be
+//              partway through the word, so it is held back until whitespace (or the final read) ends it.
+// Invariants:  Holds no whitespace.
+string partialWord;
+
 
 
 //-------|---------|---------|---------|---------|---------|---------|---------|
@@ -237,27 +294,50 @@ ifstream fileObj;
 // Functions called: 
 bool isPrimed();
 
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string trimPreNoise(string aWord);
-
-// X-----------------------------------X
-// |    #NAME    |
-// X-----------------------------------X
-// Description:      
-// Parameters:       
-// Preconditions:    
-// Postconditions:   
-// Return value:     
-// Functions called: 
-string trimPostNoise(string aWord);
+// X---------------------------X
+// |    #cleanWord(string&)    |
+// X---------------------------X
+// Description:      Lowercases a whitespace-delimited chunk and trims the noise from both its ends
+// Parameters:       aWord - The chunk, cleaned in place when valid
+// Preconditions:    None
+// Postconditions:   A valid chunk begins and ends with a letter. An invalid one is lowercased only.
+// Return value:     true if the chunk holds a letter, ie. is a word the concordance keeps
+// Functions called: None
+bool cleanWord(string& aWord);
+
+// X---------------------------X
+// |    #openNextDocument()    |
+// X---------------------------X
+// Description:      Crosses a document boundary. Closes the drained document, opens the next queued one,
+//                   clears the context window and primes the reader on the new document's first word.
+// Parameters:       None
+// Preconditions:    documentQueue is not empty
+// Postconditions:   No context word of the previous document remains in the window
+// Return value:     None
+// Functions called: resetWindow(), prime()
+void openNextDocument();
+
+// X-------------------------X
+// |    #openQueuedFile()    |
+// X-------------------------X
+// Description:      Closes the drained document and opens the next queued one, beginning its archive document
+// Parameters:       None
+// Preconditions:    documentQueue is not empty
+// Postconditions:   getDocumentID() is the new document's. The context window is untouched.
+// Return value:     None
+// Functions called: ArchiveCorpus::beginDocument()
+void openQueuedFile();
+
+// X----------------------X
+// |    #resetWindow()    |
+// X----------------------X
+// Description:      Empties the 11-word context window, as at construction
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   isPrimed() is false
+// Return value:     None
+// Functions called: None
+void resetWindow();
 
 
 public:
@@ -310,17 +390,83 @@ bool isFinished();
 // Return value:     
 // Functions called: 
 bool loadFile(string fileAddy);
+// Note: Every call after the first queues another document. Context windows never span two documents.
+
+// X-----------------------X
+// |    #resume(string)    |
+// X-----------------------X
+// Description:      Continues the archive's last document with the text of another file, as if that text
+//                   had followed it in one file. The window is seeded with the document's last five words,
+//                   so they form the first new keyword's previous context; keywords among them need no
+//                   action, as their post contexts are rebuilt from the archive and so pick up the new words.
+// Parameters:       fileAddy - Address of the file holding the continuation
+// Preconditions:    setArchive() was called with an archive holding at least one document, ie. one
+//                   loaded from a previous run. No file has been loaded into this reader.
+// Postconditions:   The next prime() makes the first new word current. Files loaded afterwards are queued
+//                   as new documents. Only the new text is read.
+// Return value:     false if the file cannot be opened
+// Functions called: resetWindow(), ArchiveCorpus::getDocumentStart(), ArchiveCorpus::getWord()
+bool resume(string fileAddy);
+
+// X-----------------------X
+// |    #follow(string)    |
+// X-----------------------X
+// Description:      Opens a file that another process is still writing, ie. an application log, as a new
+//                   document. Nothing is read until readAppended(). advance() and prime() are not used.
+// Parameters:       fileAddy - Address of the growing file
+// Preconditions:    setArchive() was called. No file has been loaded into this reader.
+// Postconditions:   getDocumentID() is the new document
+// Return value:     false if the file cannot be opened
+// Functions called: ArchiveCorpus::beginDocument()
+bool follow(string fileAddy);
+
+// X---------------------------X
+// |    #readAppended(bool)    |
+// X---------------------------X
+// Description:      Archives every complete word written to the followed file since the last call. Only the
+//                   new bytes are read. A file that has shrunk was truncated, and is read afresh as a new document.
+// Parameters:       flushPartial - true for the final read, so that a last word with no whitespace after it counts
+// Preconditions:    follow() succeeded
+// Postconditions:   The words read occupy the archive's last positions, all in document getDocumentID()
+// Return value:     Number of words archived, 0 if nothing new was written
+// Functions called: cleanWord(), ArchiveCorpus::append()
+unsigned int readAppended(bool flushPartial);
+
+// X--------------------------X
+// |    #readWord(string&)    |
+// X--------------------------X
+// Description:      Reads the next cleaned word of the corpus, crossing into queued documents, for a pass that
+//                   needs the words alone (ie. counting). No context window, context string or archive entry
+//                   is built, so a word costs little more than the extraction itself.
+// Parameters:       someWord - Receives the word
+// Preconditions:    loadFile() has been called. advance() and prime() are not used on this reader.
+// Postconditions:   getDocumentID() is the document someWord came from
+// Return value:     false once every document is drained
+// Functions called: cleanWord(), openQueuedFile()
+bool readWord(string& someWord);
+
+// X-------------------------------------X
+// |    #shiftPositions(unsigned int)    |
+// X-------------------------------------X
+// Description:      Lowers the archive position of every word in the window, to follow ArchiveCorpus::discardBefore()
+// Parameters:       someShift - Number of tokens the archive discarded
+// Preconditions:    Every word in the window is at or after someShift
+// Postconditions:   getCurrPosition() is lowered by someShift
+// Return value:     None
+// Functions called: None
+void shiftPositions(unsigned int someShift);
 
 // X------------------X
 // |    #NAME    |
 // X------------------X
-// Description:      
+// Description:      Makes a one-occurrence list for the current keyword, returned by value so that it can be
+//                   moved straight into a tree, ie. concordanceBST.insert(theScribe.makeLinkedListContext())
 // Parameters:       
 // Preconditions:    
 // Postconditions:   
-// Return value:     
+// Return value:     The list. Owns no heap storage unless its keyword outgrows small-string storage.
 // Functions called: 
-LinkedListContext* makeLinkedListContext();
+LinkedListContext makeLinkedListContext();
 
 // X------------------X
 // |    #NAME    |
@@ -395,4 +541,37 @@ string getCurrWord();
 // Functions called: 
 string getPostContext();
 
+// X------------------------X
+// |    #getDocumentID()    |
+// X------------------------X
+// Description:      Returns the document the current word was read from
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     0-based index in loadFile() order
+// Functions called: None
+unsigned int getDocumentID();
+
+// X--------------------------X
+// |    #getCurrPosition()    |
+// X--------------------------X
+// Description:      Returns the archive token position of the current word
+// Parameters:       None
+// Preconditions:    setArchive() was called before loadFile()
+// Postconditions:   None
+// Return value:     A token position
+// Functions called: None
+unsigned int getCurrPosition();
+
+// X-----------------------------------X
+// |    #setArchive(ArchiveCorpus*)    |
+// X-----------------------------------X
+// Description:      Sets the token store that every word read is appended to
+// Parameters:       someArchivePtr - Archive owned by the caller, outliving this reader
+// Preconditions:    Called before loadFile()
+// Postconditions:   None
+// Return value:     None
+// Functions called: None
+void setArchive(ArchiveCorpus* someArchivePtr);
+
 };
@@ -0,0 +1,369 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for vector operations (the counters and their heap)
+#include <vector>
+
+// Necessary for sort() (ranking the counters)
+#include <algorithm>
+
+// Field and method declarations for the SketchFrequency class
+#include "SketchFrequency.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------------X
+// |    #siftDown(unsigned int)    |
+// X-------------------------------X
+// Counts only grow, so an entry only ever moves down. Each swap updates both slots' heap places.
+void SketchFrequency::siftDown(unsigned int heapPlace) {
+   unsigned int heapSize = heapSlots.size();
+   while (true) {
+      unsigned int smallestPlace = heapPlace;
+      unsigned int leftPlace = 2 * heapPlace + 1;
+      unsigned int rightPlace = leftPlace + 1;
+      if (leftPlace < heapSize && counters[heapSlots[leftPlace]].count < counters[heapSlots[smallestPlace]].count) {
+         smallestPlace = leftPlace;
+      }
+      if (rightPlace < heapSize && counters[heapSlots[rightPlace]].count < counters[heapSlots[smallestPlace]].count) {
+         smallestPlace = rightPlace;
+      }
+      if (smallestPlace == heapPlace) {
+         return;
+      }
+      swap(heapSlots[heapPlace], heapSlots[smallestPlace]);
+      heapPlaces[heapSlots[heapPlace]] = heapPlace;
+      heapPlaces[heapSlots[smallestPlace]] = smallestPlace;
+      heapPlace = smallestPlace;
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------X
+// |    #add(string)    |
+// X--------------------X
+// A monitored word's count grows by one. Otherwise a free counter is taken, or failing that the smallest
+// one: the new word inherits its count plus one, and that count becomes the new word's error.
+void SketchFrequency::add(const string& someWord) {
+   streamLength++;
+   unordered_map<string, unsigned int>::iterator indexIt = counterIndex.find(someWord);
+   if (indexIt != counterIndex.end()) {
+      counters[indexIt->second].count++;
+      siftDown(heapPlaces[indexIt->second]);
+      return;
+   }
+   if (counters.size() < counterCapacity) {
+      // A new counter holds the least count there is, so it rises from the bottom past every larger one
+      unsigned int newSlot = counters.size();
+      Counter newCounter;
+      newCounter.word = someWord;
+      newCounter.count = 1;
+      newCounter.error = 0;
+      counters.push_back(newCounter);
+      counterIndex[someWord] = newSlot;
+      unsigned int heapPlace = heapSlots.size();
+      heapSlots.push_back(newSlot);
+      heapPlaces.push_back(heapPlace);
+      while (heapPlace > 0 && counters[heapSlots[(heapPlace - 1) / 2]].count > 1) {
+         unsigned int parentPlace = (heapPlace - 1) / 2;
+         swap(heapSlots[heapPlace], heapSlots[parentPlace]);
+         heapPlaces[heapSlots[heapPlace]] = heapPlace;
+         heapPlaces[heapSlots[parentPlace]] = parentPlace;
+         heapPlace = parentPlace;
+      }
+      return;
+   }
+   unsigned int minimumSlot = heapSlots[0];
+   Counter& minimumCounter = counters[minimumSlot];
+   counterIndex.erase(minimumCounter.word);
+   minimumCounter.word = someWord;
+   minimumCounter.error = minimumCounter.count;
+   minimumCounter.count++;
+   counterIndex[someWord] = minimumSlot;
+   evictionCount++;
+   siftDown(0);
+}
+
+// X---------------X
+// |    #rank()    |
+// X---------------X
+// Copies the counters and sorts them. Costs O(m log m) in the counters held, whatever the stream length.
+vector<SketchFrequency::Counter> SketchFrequency::rank() const {
+   vector<Counter> rankedCounters(counters);
+   sort(rankedCounters.begin(), rankedCounters.end(), [](const Counter& a, const Counter& b) {
+      return(a.count != b.count ? a.count > b.count : a.word < b.word);
+   });
+   return(rankedCounters);
+}
+
+// X-------------------------------------------------------X
+// |    #countGuaranteed(vector<Counter>, unsigned int)    |
+// X-------------------------------------------------------X
+// The first j words are the true top j when the least of their guaranteed counts is at least the next
+// estimate, since no word outside them can truly occur more often than its estimate. Past the last
+// counter, a word without one occurs at most getErrorBound() times.
+unsigned int SketchFrequency::countGuaranteed(const vector<Counter>& rankedCounters, unsigned int someCount) const {
+   unsigned int guaranteedCount = 0;
+   unsigned long long leastGuaranteed = 0;
+   for (unsigned int j = 1 ; j <= someCount && j <= rankedCounters.size() ; j++) {
+      unsigned long long thisGuaranteed = rankedCounters[j - 1].count - rankedCounters[j - 1].error;
+      if (j == 1 || thisGuaranteed < leastGuaranteed) {
+         leastGuaranteed = thisGuaranteed;
+      }
+      unsigned long long nextEstimate = (j < rankedCounters.size()) ? rankedCounters[j].count : this->getErrorBound();
+      if (leastGuaranteed >= nextEstimate) {
+         guaranteedCount = j;
+      }
+   }
+   return(guaranteedCount);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------------X
+// |    #SketchFrequency(unsigned int)    |
+// X--------------------------------------X
+// Creates an empty sketch of at most someCapacity counters
+SketchFrequency::SketchFrequency(unsigned int someCapacity) {
+   counterCapacity = (someCapacity > 0) ? someCapacity : 1;
+   streamLength = 0;
+   evictionCount = 0;
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------X
+// |    #getCapacity()    |
+// X----------------------X
+// Returns the most counters held
+unsigned int SketchFrequency::getCapacity() const {
+   return(counterCapacity);
+}
+
+// X--------------------------X
+// |    #getStreamLength()    |
+// X--------------------------X
+// Returns the words added so far
+unsigned long long SketchFrequency::getStreamLength() const {
+   return(streamLength);
+}
+
+// X------------------X
+// |    #isExact()    |
+// X------------------X
+// Returns true while no counter has been taken over
+bool SketchFrequency::isExact() const {
+   return(evictionCount == 0);
+}
+
+// X------------------------X
+// |    #getErrorBound()    |
+// X------------------------X
+// Every error was the smallest count when it was inherited, and the smallest count never falls
+unsigned long long SketchFrequency::getErrorBound() const {
+   if (evictionCount == 0) {
+      return(0);
+   }
+   return(counters[heapSlots[0]].count);
+}
@@ -0,0 +1,381 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for vector operations (the counters and their heap)
+#include <vector>
+
+// Necessary for hash table operations (finding a word's counter)
+#include <unordered_map>
+
+using namespace std;
+
+// X------------------------X
+// |    #SketchFrequency    |
+// X------------------------X
+// Description: Estimates the most frequent words of a stream in fixed memory, using the Space-Saving
+//              algorithm (Metwally, Agrawal & El Abbadi, 2005). It holds at most counterCapacity counters.
+//              A word without a counter takes over the smallest one, inheriting its count as the error.
+//              Each count is therefore an overestimate by at most its error. Every error is at most the
+//              smallest count, which is at most N / counterCapacity after N words. Any word occurring more
+//              often than that is sure to hold a counter. Until the counters first run out, every count
+//              is exact, so a small corpus gets exact counts. Each word costs one hash lookup plus a sift
+//              in a min-heap of counters.
+class SketchFrequency {
+
+public:
+// X----------------X
+// |    #Counter    |
+// X----------------X
+// Description: One monitored word, its estimated count, and the most that count may exceed the true one by
+// Invariants:  error <= count
+struct Counter {
+   string word;
+   unsigned long long count;
+   unsigned long long error;
+};
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #counterCapacity    |
+// X------------------------X
+// Description: Most counters held, fixing the memory used whatever the vocabulary
+// Invariants:  At least 1
+unsigned int counterCapacity;
+
+// X-----------------X
+// |    #counters    |
+// X-----------------X
+// Description: The counters, each in a slot that it keeps for as long as the sketch exists
+// Invariants:  At most counterCapacity entries. No word appears twice.
+vector<Counter> counters;
+
+// X------------------X
+// |    #heapSlots    |
+// X------------------X
+// Description: Min-heap of counter slots ordered by count, so the smallest counter is heapSlots[0]
+// Invariants:  heapSlots[heapPlaces[s]] == s for every slot s
+vector<unsigned int> heapSlots;
+
+// X-------------------X
+// |    #heapPlaces    |
+// X-------------------X
+// Description: Where each counter slot sits in heapSlots
+// Invariants:  As heapSlots
+vector<unsigned int> heapPlaces;
+
+// X---------------------X
+// |    #counterIndex    |
+// X---------------------X
+// Description: Slot of each monitored word
+// Invariants:  counters[counterIndex[w]].word == w for every monitored w
+unordered_map<string, unsigned int> counterIndex;
+
+// X---------------------X
+// |    #streamLength    |
+// X---------------------X
+// Description: Words added so far
+// Invariants:  Equals the sum of every counter's count
+unsigned long long streamLength;
+
+// X----------------------X
+// |    #evictionCount    |
+// X----------------------X
+// Description: Times a word took over another word's counter. While 0, every count is exact.
+// Invariants:  None
+unsigned long long evictionCount;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------------X
+// |    #siftDown(unsigned int)    |
+// X-------------------------------X
+// Description:      Moves a heap entry whose count grew down past any smaller child
+// Parameters:       heapPlace - The heap position of the counter that grew
+// Preconditions:    The heap is ordered but for this entry
+// Postconditions:   The heap is ordered
+// Return value:     None
+// Functions called: None
+void siftDown(unsigned int heapPlace);
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------X
+// |    #add(string)    |
+// X--------------------X
+// Description:      Counts one occurrence of a word
+// Parameters:       someWord - The word read
+// Preconditions:    None
+// Postconditions:   streamLength grows by one. If no counter was free, the smallest one now counts someWord.
+// Return value:     None
+// Functions called: siftDown()
+void add(const string& someWord);
+
+// X---------------X
+// |    #rank()    |
+// X---------------X
+// Description:      Returns every counter, largest count first
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     The counters ordered by count, descending, and then by word
+// Functions called: sort()
+vector<Counter> rank() const;
+
+// X-------------------------------------------------------X
+// |    #countGuaranteed(vector<Counter>, unsigned int)    |
+// X-------------------------------------------------------X
+// Description:      Finds how many of the leading ranked words are sure to be the true most frequent ones
+// Parameters:       rankedCounters - The output of rank()
+//                   someCount - The most words asked for
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     The largest j <= someCount such that the first j ranked words are exactly the true top j,
+//                   ie. each of their guaranteed counts (count - error) reaches the count ranked j + 1
+// Functions called: getErrorBound()
+unsigned int countGuaranteed(const vector<Counter>& rankedCounters, unsigned int someCount) const;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------------X
+// |    #SketchFrequency(unsigned int)    |
+// X--------------------------------------X
+// Description:      Creates an empty sketch. No counter is allocated until a word needs it.
+// Parameters:       someCapacity - Most counters to hold. 0 is taken as 1.
+SketchFrequency(unsigned int someCapacity);
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------X
+// |    #getCapacity()    |
+// X----------------------X
+// Description:      Returns the most counters held
+unsigned int getCapacity() const;
+
+// X--------------------------X
+// |    #getStreamLength()    |
+// X--------------------------X
+// Description:      Returns the words added so far
+unsigned long long getStreamLength() const;
+
+// X------------------X
+// |    #isExact()    |
+// X------------------X
+// Description:      Returns true while no counter has been taken over, ie. every count is exact
+bool isExact() const;
+
+// X------------------------X
+// |    #getErrorBound()    |
+// X------------------------X
+// Description:      Returns the most any count may exceed its word's true count by: the smallest count
+//                   once the counters have run out, which is at most getStreamLength() / getCapacity(),
+//                   or 0 while every count is exact
+unsigned long long getErrorBound() const;
+
+}; // Closing class SketchFrequency
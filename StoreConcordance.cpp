@@ -0,0 +1,531 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for file stream operations
+#include <fstream>
+
+// Necessary for vector operations (the loaded keyword lists)
+#include <vector>
+
+// Necessary for string stream operations (the tail, written and read as one block)
+#include <sstream>
+
+// Necessary for std::setw and std::setfill (the fixed-width last line)
+#include <iomanip>
+
+// Necessary for std::min and std::max
+#include <algorithm>
+
+// Necessary for std::make_move_iterator (moving the loaded lists into the tree)
+#include <iterator>
+
+// Field and method declarations for the StoreConcordance class
+#include "StoreConcordance.h"
+
+// The concordance tree saved and loaded
+#include "BSTGeneric.h"
+#include "BSTGeneric.cpp" // .cpp required here due to generic/template functionality of this class
+
+// The keyword lists, their postings, and the archive they point into
+#include "LinkedListContext.h"
+#include "ListPostings.h"
+#include "ArchiveCorpus.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------------------------------X
+// |    #writeSegment(ostream, vector, ArchiveCorpus, BSTGeneric)    |
+// X-----------------------------------------------------------------X
+// Writes a header (new documents, whether the store's last document is continued, and the seeded words),
+// the new addresses one to a line, this run's archive, then one line per keyword in key order: the
+// occurrence count, the first position, and the gaps after it. Positions are this run's. The tail
+// follows, and then its length as "end" and twenty digits, so the tail sits a known distance from the end.
+bool StoreConcordance::writeSegment(ostream& storeFile, const vector<string>& documentAddresses, const ArchiveCorpus& someArchive,
+                                    BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>& someConcordance) {
+   // A store holding a document has it continued, as this run's document 0
+   unsigned int continuedCount = (tailDocuments > 0) ? 1 : 0;
+   unsigned int documentCount = someArchive.getDocumentCount();
+   storeFile << "segment " << (documentCount - continuedCount) << " " << continuedCount << " " << tailSeeds << "\n";
+   for (unsigned int i = continuedCount ; i < documentCount ; i++) {
+      storeFile << ((i < documentAddresses.size()) ? documentAddresses[i] : "") << "\n";
+   }
+   someArchive.save(storeFile);
+   storeFile << "entries " << someConcordance.getSize() << "\n";
+   auto toFile = [&storeFile](LinkedListContext& someList) {
+      storeFile << someList.getOccurrenceCount();
+      unsigned int lastPosition = 0;
+      ListPostings::Cursor positionCursor(someList.getPositions());
+      while (positionCursor.hasNext()) {
+         unsigned int thisPosition = positionCursor.next();
+         storeFile << " " << (thisPosition - lastPosition);
+         lastPosition = thisPosition;
+      }
+      storeFile << "\n";
+   };
+   someConcordance.traversePrefix("", toFile);
+   // The tail: totals of the whole store, the width, then the last document's last words and its address
+   unsigned int tokenCount = someArchive.getTokenCount();
+   unsigned int lastStart = (documentCount > 0) ? someArchive.getDocumentStart(documentCount - 1) : tokenCount;
+   unsigned int seedCount = min(5u, tokenCount - lastStart);
+   ostringstream tailBlock;
+   tailBlock << "tail " << (tailTokens + tokenCount - tailSeeds) << " " << (tailDocuments + documentCount - continuedCount)
+             << " " << LinkedListContext::getFormatLength() << " " << seedCount << "\n";
+   for (unsigned int i = 0 ; i < seedCount ; i++) {
+      tailBlock << someArchive.getWord(tokenCount - seedCount + i) << "\n";
+   }
+   tailBlock << (documentAddresses.empty() ? "" : documentAddresses.back()) << "\n";
+   storeFile << tailBlock.str() << "end " << setw(20) << setfill('0') << tailBlock.str().length() << "\n";
+   return(!storeFile.fail());
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------------------------------X
+// |    #save(vector<string>, ArchiveCorpus, BSTGeneric)    |
+// X--------------------------------------------------------X
+// Writes a header, then the whole concordance as the first segment, continuing nothing
+bool StoreConcordance::save(const vector<string>& documentAddresses, const ArchiveCorpus& someArchive,
+                            BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>& someConcordance) {
+   ofstream storeFile(storeAddress);
+   if (!storeFile) {
+      cout << "Unable to write concordance " << storeAddress << "." << endl;
+      return(false);
+   }
+   tailTokens = 0;
+   tailDocuments = 0;
+   tailSeeds = 0;
+   storeFile << "concordance 2\n";
+   bool isWritten = this->writeSegment(storeFile, documentAddresses, someArchive, someConcordance);
+   storeFile.close();
+   return(isWritten && !storeFile.fail());
+}
+
+// X--------------------------------------------------------X
+// |    #load(vector<string>, ArchiveCorpus, BSTGeneric)    |
+// X--------------------------------------------------------X
+// Reads every segment in order. Each segment's archive is read on its own and its tokens appended to
+// someArchive (its words mapped onto the store's IDs, its seeded words skipped), so its positions move up
+// by what came before. Each keyword list is rebuilt occurrence by occurrence, exactly as the reader first
+// built it, and bulkLoad() folds the lists of one keyword from successive segments in order.
+bool StoreConcordance::load(vector<string>& documentAddresses, ArchiveCorpus& someArchive,
+                            BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>& someConcordance) {
+   ifstream storeFile(storeAddress);
+   if (!storeFile) {
+      return(false);
+   }
+   string headerTag;
+   int storeVersion = 0;
+   storeFile >> headerTag >> storeVersion;
+   if (headerTag != "concordance" || storeVersion != 2) {
+      return(false);
+   }
+   documentAddresses.clear();
+   vector<LinkedListContext> loadedLists;
+   int formatLength = 0;
+   // Invariant: every segment before this one is in someArchive, documentAddresses and loadedLists
+   while (storeFile >> headerTag) {
+      unsigned int documentCount = 0;
+      unsigned int continuedCount = 0;
+      unsigned int seedCount = 0;
+      storeFile >> documentCount >> continuedCount >> seedCount;
+      // Only the first segment begins the store, and only a continued document is seeded
+      if (storeFile.fail() || headerTag != "segment" || continuedCount != ((someArchive.getDocumentCount() > 0) ? 1u : 0u)
+          || seedCount > continuedCount * 5) {
+         return(false);
+      }
+      // Addresses may hold spaces, so each is a whole line
+      string restOfLine;
+      getline(storeFile, restOfLine);
+      for (unsigned int i = 0 ; i < documentCount ; i++) {
+         string anAddress;
+         getline(storeFile, anAddress);
+         documentAddresses.push_back(anAddress);
+      }
+      ArchiveCorpus segmentArchive;
+      if (!segmentArchive.load(storeFile) || segmentArchive.getDocumentCount() != documentCount + continuedCount) {
+         return(false);
+      }
+      unsigned int segmentTokens = segmentArchive.getTokenCount();
+      unsigned int segmentDocuments = segmentArchive.getDocumentCount();
+      if ((segmentDocuments == 0 && segmentTokens > 0) || (segmentDocuments > 0 && segmentArchive.getDocumentStart(0) != 0)) {
+         return(false);
+      }
+      // The seeded words must be the last words of the document they continue, as resume() found them
+      if (seedCount > 0) {
+         unsigned int storeTokens = someArchive.getTokenCount();
+         unsigned int firstEnd = (segmentDocuments > 1) ? segmentArchive.getDocumentStart(1) : segmentTokens;
+         if (seedCount > firstEnd || seedCount > storeTokens - someArchive.getDocumentStart(someArchive.getDocumentCount() - 1)) {
+            return(false);
+         }
+         for (unsigned int i = 0 ; i < seedCount ; i++) {
+            if (segmentArchive.getWord(i) != someArchive.getWord(storeTokens - seedCount + i)) {
+               return(false);
+            }
+         }
+      }
+      // Each segment numbers its words afresh, so its IDs are mapped onto the store's by word
+      vector<unsigned int> wordMap(segmentArchive.getVocabularySize());
+      for (unsigned int i = 0 ; i < wordMap.size() ; i++) {
+         wordMap[i] = someArchive.intern(segmentArchive.getVocabularyWord(i));
+      }
+      unsigned int positionBase = someArchive.getTokenCount();
+      for (unsigned int d = 0 ; d < segmentDocuments ; d++) {
+         if (d >= continuedCount) {
+            someArchive.beginDocument();
+         }
+         unsigned int documentEnd = (d + 1 < segmentDocuments) ? segmentArchive.getDocumentStart(d + 1) : segmentTokens;
+         for (unsigned int p = max(segmentArchive.getDocumentStart(d), seedCount) ; p < documentEnd ; p++) {
+            someArchive.appendID(wordMap[segmentArchive.getWordID(p)]);
+         }
+      }
+      unsigned int entryCount = 0;
+      storeFile >> headerTag >> entryCount;
+      if (storeFile.fail() || headerTag != "entries") {
+         return(false);
+      }
+      for (unsigned int i = 0 ; i < entryCount ; i++) {
+         unsigned int occurrenceCount = 0;
+         unsigned int thisPosition = 0;
+         storeFile >> occurrenceCount >> thisPosition;
+         if (storeFile.fail() || occurrenceCount == 0 || thisPosition < seedCount || thisPosition >= segmentTokens) {
+            return(false);
+         }
+         unsigned int storePosition = positionBase + thisPosition - seedCount;
+         string keyword = someArchive.getWord(storePosition);
+         loadedLists.push_back(LinkedListContext(keyword, storePosition, someArchive.getDocumentOf(storePosition), 0));
+         // Invariant: every gap is positive, so positions stay in corpus order
+         for (unsigned int j = 1 ; j < occurrenceCount ; j++) {
+            unsigned int thisGap = 0;
+            storeFile >> thisGap;
+            if (storeFile.fail() || thisGap == 0 || thisPosition + thisGap >= segmentTokens) {
+               return(false);
+            }
+            thisPosition = thisPosition + thisGap;
+            storePosition = positionBase + thisPosition - seedCount;
+            loadedLists.back() = LinkedListContext(keyword, storePosition, someArchive.getDocumentOf(storePosition), 0);
+         }
+      }
+      // The tail's totals must agree with what has been read; its words and address are resume()'s to use
+      unsigned int tokenTotal = 0;
+      unsigned int documentTotal = 0;
+      int tailFormat = 0;
+      unsigned int tailSeedCount = 0;
+      storeFile >> headerTag >> tokenTotal >> documentTotal >> tailFormat >> tailSeedCount;
+      if (storeFile.fail() || headerTag != "tail" || tokenTotal != someArchive.getTokenCount()
+          || documentTotal != someArchive.getDocumentCount() || tailSeedCount > 5) {
+         return(false);
+      }
+      for (unsigned int i = 0 ; i <= tailSeedCount ; i++) {
+         getline(storeFile, restOfLine);
+      }
+      getline(storeFile, restOfLine);
+      unsigned long long tailLength = 0;
+      storeFile >> headerTag >> tailLength;
+      if (storeFile.fail() || headerTag != "end") {
+         return(false);
+      }
+      formatLength = max(formatLength, tailFormat);
+   }
+   LinkedListContext::widenFormatLength(formatLength);
+   someConcordance.bulkLoad(make_move_iterator(loadedLists.begin()), make_move_iterator(loadedLists.end()));
+   return(true);
+}
+
+// X----------------------------------------------X
+// |    #resume(vector<string>, ArchiveCorpus)    |
+// X----------------------------------------------X
+// Checks the header, then reads the last line, "end" and the tail's length in twenty digits, and the
+// tail that length before it. Only these three reads touch the file, whatever the store holds.
+bool StoreConcordance::resume(vector<string>& documentAddresses, ArchiveCorpus& someArchive) {
+   ifstream storeFile(storeAddress, ios::binary);
+   if (!storeFile || someArchive.getTokenCount() != 0 || someArchive.getDocumentCount() != 0) {
+      return(false);
+   }
+   string headerTag;
+   int storeVersion = 0;
+   storeFile >> headerTag >> storeVersion;
+   if (headerTag != "concordance" || storeVersion != 2) {
+      return(false);
+   }
+   // #endLength - Bytes in the last line: "end ", twenty digits and the newline
+   const streamoff endLength = 25;
+   storeFile.seekg(0, ios::end);
+   streamoff fileLength = storeFile.tellg();
+   if (fileLength < endLength) {
+      return(false);
+   }
+   string endLine(endLength, ' ');
+   storeFile.seekg(fileLength - endLength);
+   storeFile.read(&endLine[0], endLength);
+   if (storeFile.fail() || endLine.compare(0, 4, "end ") != 0 || endLine[endLength - 1] != '\n') {
+      return(false);
+   }
+   streamoff tailLength = 0;
+   istringstream(endLine.substr(4)) >> tailLength;
+   if (tailLength <= 0 || tailLength > fileLength - endLength) {
+      return(false);
+   }
+   string tailText(tailLength, ' ');
+   storeFile.seekg(fileLength - endLength - tailLength);
+   storeFile.read(&tailText[0], tailLength);
+   istringstream tailStream(tailText);
+   int formatLength = 0;
+   tailStream >> headerTag >> tailTokens >> tailDocuments >> formatLength >> tailSeeds;
+   if (storeFile.fail() || tailStream.fail() || headerTag != "tail" || tailDocuments == 0 || tailSeeds > 5 || tailSeeds > tailTokens) {
+      return(false);
+   }
+   // The last document is begun again, holding its last words, as this run's document 0
+   someArchive.beginDocument();
+   for (unsigned int i = 0 ; i < tailSeeds ; i++) {
+      string aWord;
+      tailStream >> aWord;
+      if (tailStream.fail()) {
+         return(false);
+      }
+      someArchive.append(aWord);
+   }
+   string restOfLine;
+   string lastAddress;
+   getline(tailStream, restOfLine);
+   getline(tailStream, lastAddress);
+   documentAddresses.push_back(lastAddress);
+   LinkedListContext::widenFormatLength(formatLength);
+   return(true);
+}
+
+// X----------------------------------------------------------X
+// |    #append(vector<string>, ArchiveCorpus, BSTGeneric)    |
+// X----------------------------------------------------------X
+// Opens the store for appending, so the segment is written after everything it holds without reading any of it
+bool StoreConcordance::append(const vector<string>& documentAddresses, const ArchiveCorpus& someArchive,
+                              BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>& someConcordance) {
+   ofstream storeFile(storeAddress, ios::app);
+   if (!storeFile || tailDocuments == 0) {
+      cout << "Unable to write concordance " << storeAddress << "." << endl;
+      return(false);
+   }
+   bool isWritten = this->writeSegment(storeFile, documentAddresses, someArchive, someConcordance);
+   storeFile.close();
+   return(isWritten && !storeFile.fail());
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------------X
+// |    #StoreConcordance(string)    |
+// X---------------------------------X
+// Names the file to save to or load from
+StoreConcordance::StoreConcordance(string someAddress) {
+   storeAddress = someAddress;
+   tailTokens = 0;
+   tailDocuments = 0;
+   tailSeeds = 0;
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------X
+// |    #getAddress()    |
+// X---------------------X
+// Returns the file saved to and loaded from
+string StoreConcordance::getAddress() const {
+   return(storeAddress);
+}
@@ -0,0 +1,362 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+
+// Necessary for stream operations (writing a segment)
+#include <ostream>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for string operations
+#include <string>
+
+// Necessary for vector operations (the document address list)
+#include <vector>
+
+// The concordance tree saved and loaded
+#include "BSTGeneric.h"
+
+// The keyword lists held by the concordance
+#include "LinkedListContext.h"
+
+// Token store the saved occurrences point into
+#include "ArchiveCorpus.h"
+
+using namespace std;
+
+// X-------------------------X
+// |    #StoreConcordance    |
+// X-------------------------X
+// Description: Persists a built concordance to a text file as a log of segments, so that a later run can
+//              append new text without reading the old corpus again (-save, -append, -load). Each segment
+//              holds the documents one run added, that run's archive, and each keyword's new occurrence
+//              positions gap-coded as ListPostings holds them. Keywords are not written: each is the archived
+//              word at its first position. Every segment ends in a tail (the running totals, the width and
+//              the last words of the last document) whose length is the file's last, fixed-width line, so
+//              an append reads the tail alone and writes one segment: O(new text). Loading reads every segment.
+class StoreConcordance {
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------X
+// |    #storeAddress    |
+// X---------------------X
+// File the concordance is saved to and loaded from.
+// Invariant information: 
+string storeAddress;
+
+// X-------------------X
+// |    #tailTokens    |
+// X-------------------X
+// Positions held by the whole store when resume() read its tail. Positions this run archives after the
+// seeded words continue from here.
+// Invariant information: 0 until resume() succeeds
+unsigned int tailTokens;
+
+// X----------------------X
+// |    #tailDocuments    |
+// X----------------------X
+// Documents held by the whole store when resume() read its tail. The last of them is continued.
+// Invariant information: 0 until resume() succeeds
+unsigned int tailDocuments;
+
+// X------------------X
+// |    #tailSeeds    |
+// X------------------X
+// Words resume() re-archived from the end of the store's last document, at the start of this run's archive.
+// They are already in the store and are not written again.
+// Invariant information: 0 to 5
+unsigned int tailSeeds;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------------------------------X
+// |    #writeSegment(ostream, vector, ArchiveCorpus, BSTGeneric)    |
+// X-----------------------------------------------------------------X
+// Description:      Writes one segment and its tail: the documents and archive of this run, every keyword's
+//                   occurrences in it, and the totals of the whole store once the segment is added
+// Parameters:       storeFile - The open store, positioned at its end
+//                   documentAddresses - The corpora of this run, indexed by document ID
+//                   someArchive - This run's archive. Its first tailSeeds positions are not new.
+//                   someConcordance - This run's concordance. Deleted keywords are not written.
+// Preconditions:    tailTokens, tailDocuments and tailSeeds describe the store before this segment
+// Postconditions:   The file's last line gives the length of the tail just written
+// Return value:     false if the stream fails
+// Functions called: ArchiveCorpus::save(), BSTGeneric::traversePrefix()
+bool writeSegment(ostream& storeFile, const vector<string>& documentAddresses, const ArchiveCorpus& someArchive,
+                  BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>& someConcordance);
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X--------------------------------------------------------X
+// |    #save(vector<string>, ArchiveCorpus, BSTGeneric)    |
+// X--------------------------------------------------------X
+// Description:      Writes a concordance to storeAddress as a new store of one segment
+// Parameters:       documentAddresses - The corpora read, indexed by document ID
+//                   someArchive - The archive the concordance's positions point into
+//                   someConcordance - The concordance. Deleted keywords are not written.
+// Preconditions:    None
+// Postconditions:   load() restores the same concordance, archive and document list
+// Return value:     false if the file cannot be written
+// Functions called: writeSegment()
+bool save(const vector<string>& documentAddresses, const ArchiveCorpus& someArchive,
+          BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>& someConcordance);
+
+// X--------------------------------------------------------X
+// |    #load(vector<string>, ArchiveCorpus, BSTGeneric)    |
+// X--------------------------------------------------------X
+// Description:      Restores the whole concordance held by the store, every segment in order
+// Parameters:       documentAddresses - Receives the saved corpus addresses, indexed by document ID
+//                   someArchive - An empty archive, receiving the saved one
+//                   someConcordance - Receives the saved keywords, replacing its contents
+// Preconditions:    someArchive is empty and is the archive set on LinkedListContext
+// Postconditions:   LinkedListContext's previous-context width is at least the saved one
+// Return value:     false if the file cannot be opened or is malformed
+// Functions called: ArchiveCorpus::load(), ArchiveCorpus::appendID(), BSTGeneric::bulkLoad()
+bool load(vector<string>& documentAddresses, ArchiveCorpus& someArchive,
+          BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>& someConcordance);
+
+// X----------------------------------------------X
+// |    #resume(vector<string>, ArchiveCorpus)    |
+// X----------------------------------------------X
+// Description:      Reads the store's tail alone, so that this run can read on from where the store stopped.
+//                   The last document is begun again in the empty archive, holding its last (up to five)
+//                   words, so contexts reach back across the join. Nothing else in the store is read.
+// Parameters:       documentAddresses - Receives the last document's address, as this run's document 0
+//                   someArchive - An empty archive, receiving the seeded words
+// Preconditions:    someArchive is empty and is the archive set on LinkedListContext
+// Postconditions:   LinkedListContext's previous-context width is at least the saved one
+// Return value:     false if the file cannot be opened, is malformed, or holds no document
+// Functions called: ArchiveCorpus::beginDocument(), ArchiveCorpus::append()
+bool resume(vector<string>& documentAddresses, ArchiveCorpus& someArchive);
+
+// X----------------------------------------------------------X
+// |    #append(vector<string>, ArchiveCorpus, BSTGeneric)    |
+// X----------------------------------------------------------X
+// Description:      Adds this run's text to the store as one more segment, without reading the store
+// Parameters:       documentAddresses - This run's corpora, the continued document first
+//                   someArchive - This run's archive, begun by resume()
+//                   someConcordance - The occurrences this run read. Deleted keywords are not written.
+// Preconditions:    resume() succeeded on this object
+// Postconditions:   load() restores the store's concordance with this run's occurrences added
+// Return value:     false if the file cannot be written
+// Functions called: writeSegment()
+bool append(const vector<string>& documentAddresses, const ArchiveCorpus& someArchive,
+            BSTGeneric<LinkedListContext, LinkedListContext::KeyKeyword>& someConcordance);
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------------X
+// |    #StoreConcordance(string)    |
+// X---------------------------------X
+// Description:      Names the file to save to or load from. Nothing is opened until save(), load() or resume().
+// Parameters:       someAddress - File address, ie. "corpus.concordance"
+StoreConcordance(string someAddress);
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------X
+// |    #getAddress()    |
+// X---------------------X
+// Description:      Returns the file saved to and loaded from
+string getAddress() const;
+
+}; // Closing class StoreConcordance
@@ -0,0 +1,350 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for vector operations (the token runs tallied and the collocates ranked)
+#include <vector>
+
+// Necessary for log() and log2() (the association scores)
+#include <cmath>
+
+// Necessary for sort() (ordering the collocates)
+#include <algorithm>
+
+// Field and method declarations for the TallyCollocation class
+#include "TallyCollocation.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------X
+// |    #gapToken    |
+// X-----------------X
+// Defined here as well, since passing it by reference (ie. to push_back()) needs its storage
+const unsigned int TallyCollocation::gapToken;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------------------X
+// |    #addRun(vector<unsigned int>, size_t, size_t)    |
+// X-----------------------------------------------------X
+// One row lookup per keyword, then one count per keyword in its window. Gaps hold their place, so a
+// window never reaches past a stopword's position or across a document boundary.
+void TallyCollocation::addRun(const vector<unsigned int>& someTokens, size_t someFirst, size_t someEnd) {
+   for (size_t i = someFirst ; i < someEnd ; i++) {
+      if (someTokens[i] == gapToken) {
+         continue;
+      }
+      RowTally& thisRow = rowTallies[someTokens[i]];
+      thisRow.occurrenceCount++;
+      for (size_t j = i - tallySpan ; j <= i + tallySpan ; j++) {
+         if (j != i && someTokens[j] != gapToken) {
+            thisRow.pairCounts[someTokens[j]]++;
+            thisRow.pairTotal++;
+            grandTotal++;
+         }
+      }
+   }
+}
+
+// X--------------------------------X
+// |    #merge(TallyCollocation)    |
+// X--------------------------------X
+// Adds row by row. Costs one lookup per pair held by someTally.
+void TallyCollocation::merge(const TallyCollocation& someTally) {
+   for (auto rowIt = someTally.rowTallies.begin() ; rowIt != someTally.rowTallies.end() ; ++rowIt) {
+      RowTally& thisRow = rowTallies[rowIt->first];
+      thisRow.occurrenceCount = thisRow.occurrenceCount + rowIt->second.occurrenceCount;
+      thisRow.pairTotal = thisRow.pairTotal + rowIt->second.pairTotal;
+      for (auto pairIt = rowIt->second.pairCounts.begin() ; pairIt != rowIt->second.pairCounts.end() ; ++pairIt) {
+         thisRow.pairCounts[pairIt->first] += pairIt->second;
+      }
+   }
+   grandTotal = grandTotal + someTally.grandTotal;
+}
+
+// X-----------------------------------------X
+// |    #rank(unsigned int, unsigned int)    |
+// X-----------------------------------------X
+// Each pair (a, b) is a cell of the 2x2 table of pairs {keyword is a or not} x {neighbour is b or not},
+// whose margins are a's row total, b's row total (equal to its column total), and the grand total.
+// PMI = log2(k11 * N / (R * C)); G2 = 2 * sum(k * ln(k / E)) over the four cells, E = row * column / N.
+vector<TallyCollocation::Collocate> TallyCollocation::rank(unsigned int someWordID, unsigned int someCount) const {
+   vector<Collocate> retCollocates;
+   auto rowIt = rowTallies.find(someWordID);
+   if (rowIt == rowTallies.end() || grandTotal == 0) {
+      return(retCollocates);
+   }
+   // #cellTerm - One cell's share of G2, with 0 * ln(0) taken as 0
+   auto cellTerm = [](double observed, double expected) {
+      return((observed > 0.0) ? observed * log(observed / expected) : 0.0);
+   };
+   double totalPairs = (double)grandTotal;
+   double rowTotal = (double)rowIt->second.pairTotal;
+   for (auto pairIt = rowIt->second.pairCounts.begin() ; pairIt != rowIt->second.pairCounts.end() ; ++pairIt) {
+      double columnTotal = (double)rowTallies.at(pairIt->first).pairTotal;
+      double k11 = pairIt->second;
+      double k12 = rowTotal - k11;
+      double k21 = columnTotal - k11;
+      double k22 = totalPairs - rowTotal - columnTotal + k11;
+      double e11 = rowTotal * columnTotal / totalPairs;
+      double logLikelihood = 2.0 * (cellTerm(k11, e11)
+                                    + cellTerm(k12, rowTotal * (totalPairs - columnTotal) / totalPairs)
+                                    + cellTerm(k21, (totalPairs - rowTotal) * columnTotal / totalPairs)
+                                    + cellTerm(k22, (totalPairs - rowTotal) * (totalPairs - columnTotal) / totalPairs));
+      Collocate thisCollocate;
+      thisCollocate.wordID = pairIt->first;
+      thisCollocate.count = pairIt->second;
+      thisCollocate.mutualInformation = log2(k11 / e11);
+      thisCollocate.logLikelihood = (k11 < e11) ? -logLikelihood : logLikelihood;
+      retCollocates.push_back(thisCollocate);
+   }
+   sort(retCollocates.begin(), retCollocates.end(), [](const Collocate& a, const Collocate& b) {
+      if (a.logLikelihood != b.logLikelihood) {
+         return(a.logLikelihood > b.logLikelihood);
+      }
+      return(a.count != b.count ? a.count > b.count : a.wordID < b.wordID);
+   });
+   if (retCollocates.size() > someCount) {
+      retCollocates.resize(someCount);
+   }
+   return(retCollocates);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------------------X
+// |    #TallyCollocation(unsigned int)    |
+// X---------------------------------------X
+// An empty tally counts nothing until its first run
+TallyCollocation::TallyCollocation(unsigned int someSpan) {
+   tallySpan = (someSpan > 0) ? someSpan : 1;
+   grandTotal = 0;
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------X
+// |    #getOccurrenceCount(unsigned int)    |
+// X-----------------------------------------X
+// Returns how many times a keyword was counted
+unsigned int TallyCollocation::getOccurrenceCount(unsigned int someWordID) const {
+   auto rowIt = rowTallies.find(someWordID);
+   return((rowIt != rowTallies.end()) ? rowIt->second.occurrenceCount : 0);
+}
+
+// X-----------------------------------X
+// |    #getPairTotal(unsigned int)    |
+// X-----------------------------------X
+// Returns how many neighbours were counted around a keyword
+unsigned long long TallyCollocation::getPairTotal(unsigned int someWordID) const {
+   auto rowIt = rowTallies.find(someWordID);
+   return((rowIt != rowTallies.end()) ? rowIt->second.pairTotal : 0);
+}
+
+// X------------------X
+// |    #getSpan()    |
+// X------------------X
+// Returns the tokens either side of a keyword counted as its neighbours
+unsigned int TallyCollocation::getSpan() const {
+   return(tallySpan);
+}
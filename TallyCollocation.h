@@ -0,0 +1,350 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for vector operations (the token runs tallied and the collocates ranked)
+#include <vector>
+
+// Necessary for hash table operations (the sparse rows of counts)
+#include <unordered_map>
+
+using namespace std;
+
+// X-------------------------X
+// |    #TallyCollocation    |
+// X-------------------------X
+// Description: Counts, for each keyword, the keywords found within tallySpan tokens either side of it, as a
+//              sparse row of counts per keyword. Tokens arrive as runs of word IDs in which every stopword,
+//              and every place between documents, is gapToken: a gap holds its place in a window but is
+//              never counted. Both ends of a pair are keywords and every window is symmetric, so
+//              each keyword's row total is also its column total, and the grand total is the sum of the
+//              rows. Tallies of disjoint runs can be merged by adding their counts, so several threads may
+//              each keep their own and combine them once reading ends.
+class TallyCollocation {
+
+public:
+// X------------------X
+// |    #Collocate    |
+// X------------------X
+// Description: One collocate of a keyword, how often it fell in the keyword's windows, and how strongly
+//              that count departs from chance: pointwise mutual information (in bits) and the signed
+//              log-likelihood ratio G2 (Dunning, 1993), negative where the pair occurs less than expected
+// Invariants:  count > 0
+struct Collocate {
+   unsigned int wordID;
+   unsigned int count;
+   double mutualInformation;
+   double logLikelihood;
+};
+
+// X-----------------X
+// |    #gapToken    |
+// X-----------------X
+// Description: Token value for a stopword, or for a place between documents. Never a valid interned ID.
+static const unsigned int gapToken = 0xFFFFFFFF;
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------X
+// |    #RowTally    |
+// X-----------------X
+// Description: One keyword's occurrences, its collocates' counts, and the sum of those counts
+// Invariants:  pairTotal is the sum of pairCounts
+struct RowTally {
+   unsigned int occurrenceCount;
+   unsigned long long pairTotal;
+   unordered_map<unsigned int, unsigned int> pairCounts;
+};
+
+// X------------------X
+// |    #tallySpan    |
+// X------------------X
+// Description: Tokens either side of a keyword that count as its neighbours
+// Invariants:  At least 1
+unsigned int tallySpan;
+
+// X-------------------X
+// |    #rowTallies    |
+// X-------------------X
+// Description: The row of each keyword seen, by word ID
+// Invariants:  For keywords a and b, rowTallies[a].pairCounts[b] == rowTallies[b].pairCounts[a]
+//              once every run has been tallied
+unordered_map<unsigned int, RowTally> rowTallies;
+
+// X-------------------X
+// |    #grandTotal    |
+// X-------------------X
+// Description: Pairs counted, the sum of every pairTotal
+// Invariants:  None
+unsigned long long grandTotal;
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------------------X
+// |    #addRun(vector<unsigned int>, size_t, size_t)    |
+// X-----------------------------------------------------X
+// Description:      Counts the windows of the keywords at someTokens[someFirst] to someTokens[someEnd - 1]
+// Parameters:       someTokens - Word IDs, with gapToken for stopwords and between documents
+//                   someFirst - Index of the first keyword position to count
+//                   someEnd - Index one past the last keyword position to count
+// Preconditions:    someFirst >= tallySpan and someEnd + tallySpan <= someTokens.size(), so every window
+//                   lies inside the run. Runs overlap by 2 * tallySpan tokens but count disjoint positions.
+// Postconditions:   Each keyword counted gains an occurrence, and one pair per keyword in its window
+// Return value:     None
+// Functions called: None
+void addRun(const vector<unsigned int>& someTokens, size_t someFirst, size_t someEnd);
+
+// X--------------------------------X
+// |    #merge(TallyCollocation)    |
+// X--------------------------------X
+// Description:      Adds another tally's counts to this one
+// Parameters:       someTally - A tally of other positions, with the same span
+// Preconditions:    None
+// Postconditions:   This tally counts every position either tally counted
+// Return value:     None
+// Functions called: None
+void merge(const TallyCollocation& someTally);
+
+// X-----------------------------------------X
+// |    #rank(unsigned int, unsigned int)    |
+// X-----------------------------------------X
+// Description:      Scores a keyword's collocates and returns the most strongly associated
+// Parameters:       someWordID - The keyword's word ID
+//                   someCount - Most collocates returned
+// Preconditions:    Every run has been tallied
+// Postconditions:   None
+// Return value:     Up to someCount collocates by log-likelihood, highest first, then by count. Empty for a
+//                   keyword never tallied.
+// Functions called: None
+vector<Collocate> rank(unsigned int someWordID, unsigned int someCount) const;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------------------X
+// |    #TallyCollocation(unsigned int)    |
+// X---------------------------------------X
+// Description:      Creates an empty tally
+// Parameters:       someSpan - Tokens either side of a keyword counted as its neighbours. 0 is taken as 1.
+TallyCollocation(unsigned int someSpan);
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------X
+// |    #getOccurrenceCount(unsigned int)    |
+// X-----------------------------------------X
+// Description:      Returns how many times a keyword was counted
+unsigned int getOccurrenceCount(unsigned int someWordID) const;
+
+// X-----------------------------------X
+// |    #getPairTotal(unsigned int)    |
+// X-----------------------------------X
+// Description:      Returns how many neighbours were counted around a keyword
+unsigned long long getPairTotal(unsigned int someWordID) const;
+
+// X------------------X
+// |    #getSpan()    |
+// X------------------X
+// Description:      Returns the tokens either side of a keyword counted as its neighbours
+unsigned int getSpan() const;
+
+}; // Closing class TallyCollocation
@@ -0,0 +1,306 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for std::swap (exchanging two arrays)
+#include <utility>
+
+// Field and method declarations for the VectorChunked class
+#include "VectorChunked.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------X
+// |    #push_back(<typeT>)    |
+// X---------------------------X
+// Writes the element, and any new chunk or directory, before publishing the new count, so a reader never
+// sees a half-written slot
+template <class typeT>
+void VectorChunked<typeT>::push_back(const typeT& someData) {
+   size_t thisIndex = elementCount.load(memory_order_relaxed);
+   size_t thisChunk = thisIndex >> chunkBits;
+   typeT** thisDirectory = chunkDirectory.load(memory_order_relaxed);
+   if (thisChunk == chunkCount) {
+      if (chunkCount == directoryLength) {
+         size_t newLength = (directoryLength == 0) ? 16 : directoryLength * 2;
+         typeT** newDirectory = new typeT*[newLength];
+         for (size_t i = 0 ; i < chunkCount ; i++) {
+            newDirectory[i] = thisDirectory[i];
+         }
+         if (thisDirectory != nullptr) {
+            retiredDirectories.push_back(thisDirectory);
+         }
+         thisDirectory = newDirectory;
+         directoryLength = newLength;
+      }
+      thisDirectory[chunkCount] = new typeT[(size_t)1 << chunkBits];
+      chunkCount++;
+      chunkDirectory.store(thisDirectory, memory_order_release);
+   }
+   thisDirectory[thisChunk][thisIndex & (((size_t)1 << chunkBits) - 1)] = someData;
+   elementCount.store(thisIndex + 1, memory_order_release);
+}
+
+// X---------------------------X
+// |    #operator[](size_t)    |
+// X---------------------------X
+template <class typeT>
+const typeT& VectorChunked<typeT>::operator[](size_t someIndex) const {
+   return(chunkDirectory.load(memory_order_acquire)[someIndex >> chunkBits][someIndex & (((size_t)1 << chunkBits) - 1)]);
+}
+
+// X---------------X
+// |    #back()    |
+// X---------------X
+template <class typeT>
+const typeT& VectorChunked<typeT>::back() const {
+   return((*this)[size() - 1]);
+}
+
+
+// X------------------------------------X
+// |    #swap(VectorChunked<typeT>&)    |
+// X------------------------------------X
+// The atomics are exchanged through plain loads and stores, as no reader may be present
+template <class typeT>
+void VectorChunked<typeT>::swap(VectorChunked<typeT>& someArray) {
+   typeT** thisDirectory = chunkDirectory.load(memory_order_relaxed);
+   chunkDirectory.store(someArray.chunkDirectory.load(memory_order_relaxed), memory_order_relaxed);
+   someArray.chunkDirectory.store(thisDirectory, memory_order_relaxed);
+   size_t thisCount = elementCount.load(memory_order_relaxed);
+   elementCount.store(someArray.elementCount.load(memory_order_relaxed), memory_order_relaxed);
+   someArray.elementCount.store(thisCount, memory_order_relaxed);
+   std::swap(directoryLength, someArray.directoryLength);
+   std::swap(chunkCount, someArray.chunkCount);
+   retiredDirectories.swap(someArray.retiredDirectories);
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #VectorChunked()    |
+// X------------------------X
+template <class typeT>
+VectorChunked<typeT>::VectorChunked() : chunkDirectory(nullptr), elementCount(0) {
+   directoryLength = 0;
+   chunkCount = 0;
+}
+
+// X-------------------------X
+// |    #~VectorChunked()    |
+// X-------------------------X
+template <class typeT>
+VectorChunked<typeT>::~VectorChunked() {
+   typeT** thisDirectory = chunkDirectory.load(memory_order_relaxed);
+   for (size_t i = 0 ; i < chunkCount ; i++) {
+      delete[] thisDirectory[i];
+   }
+   delete[] thisDirectory;
+   for (size_t i = 0 ; i < retiredDirectories.size() ; i++) {
+      delete[] retiredDirectories[i];
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------X
+// |    #size()    |
+// X---------------X
+template <class typeT>
+size_t VectorChunked<typeT>::size() const {
+   return(elementCount.load(memory_order_acquire));
+}
+
+// X----------------X
+// |    #empty()    |
+// X----------------X
+template <class typeT>
+bool VectorChunked<typeT>::empty() const {
+   return(size() == 0);
+}
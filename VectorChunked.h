@@ -0,0 +1,330 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for the published element count (atomic)
+#include <atomic>
+
+// Necessary for size_t
+#include <cstddef>
+
+// Necessary for vector operations (retired directories)
+#include <vector>
+
+using namespace std;
+
+// X----------------------X
+// |    #VectorChunked    |
+// X----------------------X
+// Description: Generic append-only array whose elements never move. Elements live in fixed chunks of 4096,
+//              found through a directory of chunk pointers; growing allocates a chunk, and a full directory is
+//              replaced by a copy twice the size, rather than the elements being reallocated and copied.
+//              One writer may push_back() while any number of readers index elements below size(): the
+//              count is published with release order after the element (and any new directory) is written,
+//              and read with acquire. Replaced directories are kept until destruction, since a reader may
+//              still be holding one. Not copyable.
+template <class typeT>
+class VectorChunked {
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------X
+// |    #chunkBits    |
+// X------------------X
+// Log2 of the chunk length.
+// Invariant information: 
+static const int chunkBits = 12;
+
+// X-----------------------X
+// |    #chunkDirectory    |
+// X-----------------------X
+// Current directory: element i is chunkDirectory[i >> chunkBits][i & (2^chunkBits - 1)].
+// Invariant information: Holds directoryLength entries, the first chunkCount of them allocated
+atomic<typeT**> chunkDirectory;
+
+// X------------------------X
+// |    #directoryLength    |
+// X------------------------X
+// Capacity of the current directory, in chunks. Writer only.
+// Invariant information: 
+size_t directoryLength;
+
+// X-------------------X
+// |    #chunkCount    |
+// X-------------------X
+// Number of chunks allocated. Writer only.
+// Invariant information: 
+size_t chunkCount;
+
+// X---------------------------X
+// |    #retiredDirectories    |
+// X---------------------------X
+// Directories replaced by a larger one, freed on destruction. Writer only.
+// Invariant information: 
+vector<typeT**> retiredDirectories;
+
+// X---------------------X
+// |    #elementCount    |
+// X---------------------X
+// Number of elements appended.
+// Invariant information: Every element below it is fully written
+atomic<size_t> elementCount;
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------X
+// |    #push_back(<typeT>)    |
+// X---------------------------X
+// Description:      Appends a copy of someData, allocating a new chunk when the last one is full
+// Preconditions:    Called by one thread at a time
+// Postconditions:   size() grows by one
+void push_back(const typeT& someData);
+
+// X---------------------------X
+// |    #operator[](size_t)    |
+// X---------------------------X
+// Description:      Returns an element
+// Preconditions:    someIndex < size()
+// Return value:     The element, at an address that stays valid until the array is destroyed
+const typeT& operator[](size_t someIndex) const;
+
+// X---------------X
+// |    #back()    |
+// X---------------X
+// Description:      Returns the last element
+// Preconditions:    size() > 0
+const typeT& back() const;
+
+// X------------------------------------X
+// |    #swap(VectorChunked<typeT>&)    |
+// X------------------------------------X
+// Description:      Exchanges contents with another array in O(1), ie. to replace an array with a compacted copy
+// Preconditions:    No reader is indexing either array
+// Postconditions:   Each array holds the other's elements
+void swap(VectorChunked<typeT>& someArray);
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X------------------------X
+// |    #VectorChunked()    |
+// X------------------------X
+// Default constructor. Makes an empty array; no chunk is allocated until the first push_back().
+VectorChunked();
+
+// X-------------------------X
+// |    #~VectorChunked()    |
+// X-------------------------X
+// Destructor. Frees every chunk and directory.
+~VectorChunked();
+
+VectorChunked(const VectorChunked&) = delete;
+VectorChunked& operator=(const VectorChunked&) = delete;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------X
+// |    #size()    |
+// X---------------X
+// Description:      Returns the number of elements, every one of which is safe to read
+// Return value:     >= 0
+size_t size() const;
+
+// X----------------X
+// |    #empty()    |
+// X----------------X
+// Description:      Reports whether the array has no elements
+bool empty() const;
+
+}; // Closing class VectorChunked
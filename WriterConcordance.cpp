@@ -0,0 +1,484 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// IndexSuffix.h
+// IndexSuffix.cpp
+// AutomatonPattern.h
+// AutomatonPattern.cpp
+// WriterConcordance.h
+// WriterConcordance.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// Necessary for input-output operations (the stream the records are written to)
+#include <iostream>
+
+// Necessary for string operations (the buffer and the keywords written)
+#include <string>
+
+// Field and method declarations for the WriterConcordance class
+#include "WriterConcordance.h"
+
+// The token store the context words are read from
+#include "ArchiveCorpus.h"
+
+using namespace std;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------X
+// |    #appendNumber(unsigned int)    |
+// X-----------------------------------X
+// Digits are produced backwards into a small array, then appended in order
+void WriterConcordance::appendNumber(unsigned int someNumber) {
+   char digitChars[10];
+   int digitCount = 0;
+   do {
+      digitChars[digitCount++] = (char)('0' + someNumber % 10);
+      someNumber = someNumber / 10;
+   } while (someNumber > 0);
+   while (digitCount > 0) {
+      bufferData.push_back(digitChars[--digitCount]);
+   }
+}
+
+// X-----------------------------------X
+// |    #appendUInt32(unsigned int)    |
+// X-----------------------------------X
+// Least significant byte first, whatever the host's byte order
+void WriterConcordance::appendUInt32(unsigned int someNumber) {
+   for (int i = 0 ; i < 4 ; i++) {
+      bufferData.push_back((char)((someNumber >> (8 * i)) & 0xFF));
+   }
+}
+
+// X---------------------------X
+// |    #appendText(string)    |
+// X---------------------------X
+// Cleaned words are lowercase letters, so the escapes are for safety rather than the common case
+void WriterConcordance::appendText(const string& someText) {
+   if (outputFormat == formatBinary) {
+      appendUInt32(someText.length());
+      bufferData.append(someText);
+      return;
+   }
+   if (outputFormat == formatJSONLines) {
+      bufferData.push_back('"');
+   }
+   for (size_t i = 0 ; i < someText.length() ; i++) {
+      unsigned char thisChar = someText[i];
+      if (thisChar == '\\') {
+         bufferData.append("\\\\");
+      }
+      else if (thisChar == '\t') {
+         bufferData.append("\\t");
+      }
+      else if (thisChar == '\n') {
+         bufferData.append("\\n");
+      }
+      else if (outputFormat == formatJSONLines && thisChar == '"') {
+         bufferData.append("\\\"");
+      }
+      else if (outputFormat == formatJSONLines && thisChar < 0x20) {
+         const char* hexDigits = "0123456789abcdef";
+         bufferData.append("\\u00");
+         bufferData.push_back(hexDigits[thisChar >> 4]);
+         bufferData.push_back(hexDigits[thisChar & 0x0F]);
+      }
+      else {
+         bufferData.push_back((char)thisChar);
+      }
+   }
+   if (outputFormat == formatJSONLines) {
+      bufferData.push_back('"');
+   }
+}
+
+// X-----------------------------------------------------------------X
+// |    #appendContext(ArchiveCorpus, unsigned int, unsigned int)    |
+// X-----------------------------------------------------------------X
+// Words are taken from the vocabulary by ID, so none is copied out of the archive on the way
+void WriterConcordance::appendContext(const ArchiveCorpus& someArchive, unsigned int firstPosition, unsigned int endPosition) {
+   if (outputFormat == formatBinary) {
+      appendUInt32(endPosition - firstPosition);
+   }
+   else if (outputFormat == formatJSONLines) {
+      bufferData.push_back('[');
+   }
+   for (unsigned int i = firstPosition ; i < endPosition ; i++) {
+      if (i > firstPosition && outputFormat == formatJSONLines) {
+         bufferData.push_back(',');
+      }
+      else if (i > firstPosition && outputFormat == formatTSV) {
+         bufferData.push_back(' ');
+      }
+      appendText(someArchive.getVocabularyWord(someArchive.getWordID(i)));
+   }
+   if (outputFormat == formatJSONLines) {
+      bufferData.push_back(']');
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------------X
+// |    #parseFormat(string)    |
+// X----------------------------X
+// Format names as given to -format
+int WriterConcordance::parseFormat(const string& someName) {
+   if (someName == "jsonl") {
+      return(formatJSONLines);
+   }
+   if (someName == "tsv") {
+      return(formatTSV);
+   }
+   if (someName == "binary") {
+      return(formatBinary);
+   }
+   return(0);
+}
+
+// X------------------------------------------------------X
+// |    #beginList(string, unsigned int, unsigned int)    |
+// X------------------------------------------------------X
+// A TSV list writes nothing of its own: its keyword is held for the rows
+void WriterConcordance::beginList(const string& someKeyword, unsigned int someCount, unsigned int someTotal) {
+   currentKeyword = someKeyword;
+   listOccurrences = 0;
+   if (outputFormat == formatJSONLines) {
+      bufferData.append("{\"keyword\":");
+      appendText(someKeyword);
+      bufferData.append(",\"total\":");
+      appendNumber(someTotal);
+      bufferData.append(",\"occurrences\":[");
+   }
+   else if (outputFormat == formatBinary) {
+      appendText(someKeyword);
+      appendUInt32(someCount);
+      appendUInt32(someTotal);
+   }
+}
+
+// X---------------------------------------------------------------------------------X
+// |    #writeOccurrence(ArchiveCorpus, unsigned int, unsigned int, unsigned int)    |
+// X---------------------------------------------------------------------------------X
+// The context stops at the bounds of the document holding the occurrence, as getPrevContext() and
+// getPostContext() do, but with no empty slots
+void WriterConcordance::writeOccurrence(const ArchiveCorpus& someArchive, unsigned int someDocumentID, unsigned int somePosition, unsigned int someSpan) {
+   unsigned int archiveDocument = someArchive.getDocumentOf(somePosition);
+   unsigned int documentStart = someArchive.getDocumentStart(archiveDocument);
+   unsigned int documentEnd = someArchive.getTokenCount();
+   if (archiveDocument + 1 < someArchive.getDocumentCount()) {
+      documentEnd = someArchive.getDocumentStart(archiveDocument + 1);
+   }
+   unsigned int leftStart = (somePosition >= documentStart + 5) ? somePosition - 5 : documentStart;
+   unsigned int rightStart = somePosition + someSpan;
+   unsigned int rightEnd = (rightStart + 5 < documentEnd) ? rightStart + 5 : documentEnd;
+   rightStart = (rightStart < rightEnd) ? rightStart : rightEnd;
+
+   if (outputFormat == formatJSONLines) {
+      if (listOccurrences > 0) {
+         bufferData.push_back(',');
+      }
+      bufferData.append("{\"document\":");
+      appendNumber(someDocumentID);
+      bufferData.append(",\"position\":");
+      appendNumber(somePosition);
+      bufferData.append(",\"left\":");
+      appendContext(someArchive, leftStart, somePosition);
+      bufferData.append(",\"right\":");
+      appendContext(someArchive, rightStart, rightEnd);
+      bufferData.push_back('}');
+   }
+   else if (outputFormat == formatTSV) {
+      appendText(currentKeyword);
+      bufferData.push_back('\t');
+      appendNumber(someDocumentID);
+      bufferData.push_back('\t');
+      appendNumber(somePosition);
+      bufferData.push_back('\t');
+      appendContext(someArchive, leftStart, somePosition);
+      bufferData.push_back('\t');
+      appendContext(someArchive, rightStart, rightEnd);
+      bufferData.push_back('\n');
+   }
+   else {
+      appendUInt32(someDocumentID);
+      appendUInt32(somePosition);
+      appendContext(someArchive, leftStart, somePosition);
+      appendContext(someArchive, rightStart, rightEnd);
+   }
+   listOccurrences++;
+   recordCount++;
+   if (bufferData.size() >= bufferCapacity) {
+      flush();
+   }
+}
+
+// X------------------X
+// |    #endList()    |
+// X------------------X
+// Only a JSON object has anything to close
+void WriterConcordance::endList() {
+   if (outputFormat == formatJSONLines) {
+      bufferData.append("]}\n");
+   }
+   if (bufferData.size() >= bufferCapacity) {
+      flush();
+   }
+}
+
+// X----------------X
+// |    #flush()    |
+// X----------------X
+// One write per buffer, however many records it holds
+void WriterConcordance::flush() {
+   byteCount = byteCount + bufferData.size();
+   outputStream->write(bufferData.data(), bufferData.size());
+   outputStream->flush();
+   bufferData.clear();
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------X
+// |    #WriterConcordance(int, ostream&)    |
+// X-----------------------------------------X
+// The buffer is reserved whole up front, with room for the record that crosses the capacity. A binary
+// file opens with its magic, so even one without a keyword reads as KWICBIN1.
+WriterConcordance::WriterConcordance(int someFormat, ostream& someStream) {
+   outputFormat = someFormat;
+   outputStream = &someStream;
+   bufferCapacity = 1 << 20;
+   bufferData.reserve(bufferCapacity + 4096);
+   listOccurrences = 0;
+   recordCount = 0;
+   byteCount = 0;
+   if (outputFormat == formatBinary) {
+      bufferData.append("KWICBIN1");
+   }
+}
+
+// X-----------------------------X
+// |    #~WriterConcordance()    |
+// X-----------------------------X
+// Anything still buffered is written out
+WriterConcordance::~WriterConcordance() {
+   if (!bufferData.empty()) {
+      flush();
+   }
+}
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------X
+// |    #getRecordCount()    |
+// X-------------------------X
+// Returns the occurrences written
+unsigned long long WriterConcordance::getRecordCount() const {
+   return(recordCount);
+}
+
+// X-----------------------X
+// |    #getByteCount()    |
+// X-----------------------X
+// Returns the bytes written and buffered
+unsigned long long WriterConcordance::getByteCount() const {
+   return(byteCount + bufferData.size());
+}
@@ -0,0 +1,463 @@
+// Tim Lum
+// twhlum@gmail.com
+// 2017.12.04
+// For the University of Washington Bothell CSS 501A
+// Autumn 2017, Graduate Certificate in Software Design & Development (GCSDD)
+//
+// File Description:
+// This file is the driver file for the Concordance Assignment. This program shall accept a list of
+// stopwords (stopwords.txt) as well as a command argument corpus location. From these bodies of data
+// it will generate a concordance in KeyWord In Context (KWIC) format.
+//
+// Package files:
+// Driver.cpp
+// BSTGeneric.h
+// BSTGeneric.cpp
+// NodeGeneric.cpp
+// ReaderCorpus.h
+// ReaderCorpus.cpp
+// LinkedListContext.h
+// LinkedListContext.cpp
+// NodeContext.cpp
+// ArchiveCorpus.h
+// ArchiveCorpus.cpp
+// ListPostings.h
+// ListPostings.cpp
+// HashTableGeneric.h
+// HashTableGeneric.cpp
+// BenchmarkCorpus.h
+// BenchmarkCorpus.cpp
+// RadixTreeGeneric.h
+// RadixTreeGeneric.cpp
+// VectorChunked.h
+// VectorChunked.cpp
+// BSTConcurrent.h
+// BSTConcurrent.cpp
+// StoreConcordance.h
+// StoreConcordance.cpp
+// SketchFrequency.h
+// SketchFrequency.cpp
+// SketchCountMin.h
+// SketchCountMin.cpp
+// TallyCollocation.h
+// TallyCollocation.cpp
+// IndexSuffix.h
+// IndexSuffix.cpp
+// AutomatonPattern.h
+// AutomatonPattern.cpp
+// WriterConcordance.h
+// WriterConcordance.cpp
+// stopwords.txt (recommended)
+// Corpus (not named, name must be passed as a command argument)
+//
+// Acknowledgements:
+// Source material from:
+// University of Washington Bothell
+// CSS 501A Data Structures And Object-Oriented Programming I
+// "Design and Coding Standards"
+// Michael Stiber
+//
+// Template author:
+// Tim Lum (twhlum@gmail.com)
+//
+// License:
+// This software is published under the GNU general license which guarantees
+// end users the freedom to run, study, share and modify the software.
+// https://www.gnu.org/licenses/gpl.html
+//
+// Code Standards:
+// I. Comment at beginning of file (above) stating (at a minimum):
+//    A. File Name
+//    B. Author Name
+//    C. Date
+//    D. Description of code purpose 
+// II. Indentation:
+//    A. 3 whitespaces ("   ")
+//    B. May vary depending on language and instructor
+// III. Variables:
+//    A. Descriptive, legible name
+//    B. Comment over any variable declaration describing:
+//       0. Its use in the algorithm
+//       1. Invariant information such as legal ranges of values
+// IV. Class Files:
+//    A. Separate *.cpp and *.h files should be used for each class.
+//    B. Files names must exactly match class names (case-sensitive)
+// V. Includes:
+//    A. Calls for content ("#include") from the Standard Template Library (STL) should be formatted as follows:
+//       0. DO type:     #include <vector>
+//       1. Do NOT type: #include <vector.h>
+//    B. You may use the directive "using namespace std;"
+//       0. ??? (?CONFIRM?)
+// VI. Classes:
+//    A. Return values:
+//       0. Do NOT return references to internal class structures.
+//       1. Do NOT return pointers to internal class structures.
+//    B. Do NOT expose any details of the internal implementation.
+// VII. Functions + Methods:
+//    A. Functions should be used for appropriate operations.
+//    B. Reference arguments should be used only when necessary.
+//    C. The (return?CONFIRM?) type of each function must be declared
+//       0. Use 'void' when necessary
+//    D. Declare as 'const' (unalterable) when no modification is made to the object state
+//       0. UML 'query' property (?CONFIRM?)
+// VIII. Function Comments:
+//    A. DO include a comment prior to each function which includes the function's:
+//       0. Purpose - Why does the function exist?
+//       1. Parameters - What fields does the function contain?
+//       2. Preconditions - What conditions must be true prior to the function call?
+//       3. Postconditions - What conditions must be true after the function call?
+//       4. Return value - What is the nature and range of the value returned by the function?
+//       5. Functions called - What other functions are called by this function?
+// IX. Loop invariants
+//    A. Each loop should be commented with 'invariant' information (?CONFIRM?)
+// X. Assertions:
+//    A. May be comments or the 'assert()' feature.
+//    B. Insert where useful to explain important features or subtle logic.
+//    C. What, exactly, is an assertion (?CONFIRM?)
+// XI. Prohibited (unless justified):
+//    A. Global variables
+//    B. "Gotos" (?CONFIRM?)
+//
+// Special instructions:
+// To install G++:
+// sudo apt install g++
+// 
+// To update Linux:
+// sudo apt-get update && sudo apt-get install
+// sudo apt-get update
+//
+// To make a new .cpp file in Linux:
+// nano <file name>.cpp
+//
+// To make a new .h file in Linux:
+// nano <file name>.h
+//
+// To make a new .txt file in Linux:
+// nano <file name>.txt
+//
+// To compile in g++:
+// g++ -std=c++11 *.cpp
+//
+// To run with test input:
+// ./a.out < TestInput.txt
+//
+// To run Valgrind:
+// Install Valgrind:
+// sudo apt install valgrind
+//
+// Run with:
+// valgrind --leak-check=full <file folder path>/<file name, usually a.out>
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all <file path>/a.out
+//
+// ie.
+// valgrind --leak-check=full /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out
+// OR
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out < /Sudoku.txt
+//
+// To load a text file as cin input in Visual Studios:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. "< <Filepath>/<Filename>.txt" ie. "< /Sudoku.txt"
+// ie. < /Sudoku.txt
+//
+// To pass a command argument:
+// 1. Go to the top menu bar => Debug => <ProjectName> Properties => Debugging => Command Arguments =>
+// 2. Enter the file address and name
+// ie. corpus.txt
+// 3. Alter main() method signature as follows: main( int argc, char* argv[] ) {
+// 4. The variable "argv[1]" now refers to the first command argument passed
+//
+// To run in Linux with Valgrind and a command argument
+// valgrind --leak-check=full --show-leak-kinds=all /home/Teabean/a.out Sudoku.txt
+//
+// ---- BEGIN STUDENT CODE ----
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       INCLUDE STATEMENTS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+#pragma once
+
+// Necessary for input-output operations (the stream the records are written to)
+#include <iostream>
+
+// Necessary for string operations (the buffer and the keywords written)
+#include <string>
+
+// The token store the context words are read from
+#include "ArchiveCorpus.h"
+
+using namespace std;
+
+// X--------------------------X
+// |    #WriterConcordance    |
+// X--------------------------X
+// Description: Writes concordance entries as machine-readable records instead of the aligned KWIC text.
+//              Three formats are offered:
+//              JSON Lines - One object per keyword, ie.
+//                           {"keyword":"arms","total":1,"occurrences":[{"document":0,"position":41,
+//                           "left":["or","to","take"],"right":["against","a"]}]}
+//                           "total" counts every occurrence seen, which exceeds the listed ones when capped.
+//              TSV        - One row per occurrence: keyword, document, position, left context, right
+//                           context, the context words separated by single spaces. Tab, newline and
+//                           backslash in a field are written as \t, \n and \\.
+//              Binary     - "KWICBIN1" (even when no keyword follows), then per keyword its length and
+//                           bytes, the occurrences listed and the total, then per occurrence its document,
+//                           position, and the counts and words of its left and right contexts. Every count
+//                           and length is a little-endian uint32, and every word is written whole.
+//              Context is up to five words either side, stopping at the document's bounds, with no
+//              padding: the records need no formatLength pass. Records build up in one large buffer
+//              that is written to the stream whole, so the stream sees few, large writes.
+class WriterConcordance {
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------------------------------------X
+// |    #formatJSONLines, #formatTSV, #formatBinary    |
+// X---------------------------------------------------X
+// Description: The record formats, as held by outputFormat
+// Invariants:  None
+static const int formatJSONLines = 1;
+static const int formatTSV = 2;
+static const int formatBinary = 3;
+
+
+
+private:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE FIELDS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X---------------------X
+// |    #outputFormat    |
+// X---------------------X
+// Description: One of formatJSONLines, formatTSV or formatBinary
+// Invariants:  None
+int outputFormat;
+
+// X---------------------X
+// |    #outputStream    |
+// X---------------------X
+// Description: Stream the buffer is written to. Not owned.
+// Invariants:  Not nullptr
+ostream* outputStream;
+
+// X-------------------X
+// |    #bufferData    |
+// X-------------------X
+// Description: Records not yet written to outputStream
+// Invariants:  Written out once it reaches bufferCapacity, so it never grows far past it
+string bufferData;
+
+// X-----------------------X
+// |    #bufferCapacity    |
+// X-----------------------X
+// Description: Size the buffer is written out at, 1 MiB
+// Invariants:  None
+size_t bufferCapacity;
+
+// X-----------------------X
+// |    #currentKeyword    |
+// X-----------------------X
+// Description: Keyword of the list being written, repeated on each TSV row
+// Invariants:  None
+string currentKeyword;
+
+// X------------------------X
+// |    #listOccurrences    |
+// X------------------------X
+// Description: Occurrences written so far for the current list, to separate the JSON array elements
+// Invariants:  None
+unsigned int listOccurrences;
+
+// X--------------------------------X
+// |    #recordCount, #byteCount    |
+// X--------------------------------X
+// Description: Occurrences written, and bytes written to outputStream plus those still buffered
+// Invariants:  None
+unsigned long long recordCount;
+unsigned long long byteCount;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PRIVATE METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------X
+// |    #appendNumber(unsigned int)    |
+// X-----------------------------------X
+// Description:      Appends a number in decimal, without going through a stream
+// Parameters:       someNumber - The number
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     None
+// Functions called: None
+void appendNumber(unsigned int someNumber);
+
+// X-----------------------------------X
+// |    #appendUInt32(unsigned int)    |
+// X-----------------------------------X
+// Description:      Appends a number as four little-endian bytes
+// Parameters:       someNumber - The number
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     None
+// Functions called: None
+void appendUInt32(unsigned int someNumber);
+
+// X---------------------------X
+// |    #appendText(string)    |
+// X---------------------------X
+// Description:      Appends a keyword or word escaped for the format: quoted for JSON Lines, escaped for
+//                   TSV, and preceded by its length for the binary format
+// Parameters:       someText - The text
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     None
+// Functions called: appendUInt32()
+void appendText(const string& someText);
+
+// X-----------------------------------------------------------------X
+// |    #appendContext(ArchiveCorpus, unsigned int, unsigned int)    |
+// X-----------------------------------------------------------------X
+// Description:      Appends the words of the positions firstPosition up to endPosition as one context: a
+//                   JSON array, a space-separated TSV field, or a count and its words
+// Parameters:       someArchive - The archive the words are read from
+//                   firstPosition, endPosition - The positions, endPosition excluded
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     None
+// Functions called: appendText(), appendUInt32(), ArchiveCorpus::getVocabularyWord()
+void appendContext(const ArchiveCorpus& someArchive, unsigned int firstPosition, unsigned int endPosition);
+
+
+
+public:
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       PUBLIC METHODS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X----------------------------X
+// |    #parseFormat(string)    |
+// X----------------------------X
+// Description:      Reads a format name
+// Parameters:       someName - "jsonl", "tsv" or "binary"
+// Preconditions:    None
+// Postconditions:   None
+// Return value:     The format, or 0 for a name not recognized
+// Functions called: None
+static int parseFormat(const string& someName);
+
+// X------------------------------------------------------X
+// |    #beginList(string, unsigned int, unsigned int)    |
+// X------------------------------------------------------X
+// Description:      Starts the records of one keyword
+// Parameters:       someKeyword - The keyword, or the phrase of an n-gram entry
+//                   someCount - Occurrences that will be written for it
+//                   someTotal - Occurrences seen, more than someCount when the list was sampled
+// Preconditions:    The previous list, if any, has ended
+// Postconditions:   None
+// Return value:     None
+// Functions called: appendText(), appendNumber(), appendUInt32()
+void beginList(const string& someKeyword, unsigned int someCount, unsigned int someTotal);
+
+// X---------------------------------------------------------------------------------X
+// |    #writeOccurrence(ArchiveCorpus, unsigned int, unsigned int, unsigned int)    |
+// X---------------------------------------------------------------------------------X
+// Description:      Writes one occurrence with its context
+// Parameters:       someArchive - The archive the occurrence lies in
+//                   someDocumentID - Document of the occurrence
+//                   somePosition - Token position of its first word
+//                   someSpan - Words in the keyword; the right context starts after them
+// Preconditions:    A list has begun, and has had fewer occurrences than its someCount
+// Postconditions:   The buffer is written out if it has reached bufferCapacity
+// Return value:     None
+// Functions called: appendContext(), appendNumber(), appendUInt32(), flush()
+void writeOccurrence(const ArchiveCorpus& someArchive, unsigned int someDocumentID, unsigned int somePosition, unsigned int someSpan);
+
+// X------------------X
+// |    #endList()    |
+// X------------------X
+// Description:      Ends the records of the current keyword
+// Parameters:       None
+// Preconditions:    A list has begun, and has had its someCount occurrences
+// Postconditions:   The buffer is written out if it has reached bufferCapacity
+// Return value:     None
+// Functions called: flush()
+void endList();
+
+// X----------------X
+// |    #flush()    |
+// X----------------X
+// Description:      Writes the buffer to the stream and flushes the stream
+// Parameters:       None
+// Preconditions:    None
+// Postconditions:   The buffer is empty
+// Return value:     None
+// Functions called: ostream::write()
+void flush();
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       CONSTRUCTORS / DESTRUCTORS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-----------------------------------------X
+// |    #WriterConcordance(int, ostream&)    |
+// X-----------------------------------------X
+// Description:      Creates a writer of one format onto a stream
+// Parameters:       someFormat - formatJSONLines, formatTSV or formatBinary
+//                   someStream - The stream written to, which must outlive the writer
+WriterConcordance(int someFormat, ostream& someStream);
+
+// X-----------------------------X
+// |    #~WriterConcordance()    |
+// X-----------------------------X
+// Description:      Writes out whatever is still buffered
+~WriterConcordance();
+
+WriterConcordance(const WriterConcordance&) = delete;
+WriterConcordance& operator=(const WriterConcordance&) = delete;
+
+
+
+//-------|---------|---------|---------|---------|---------|---------|---------|
+//
+//       GETTERS / SETTERS
+//
+//-------|---------|---------|---------|---------|---------|---------|---------|
+
+// X-------------------------X
+// |    #getRecordCount()    |
+// X-------------------------X
+// Description:      Returns the occurrences written
+unsigned long long getRecordCount() const;
+
+// X-----------------------X
+// |    #getByteCount()    |
+// X-----------------------X
+// Description:      Returns the bytes written, counting those still buffered
+unsigned long long getByteCount() const;
+
+}; // Closing class WriterConcordance